@@ -0,0 +1,206 @@
+/*************************************************
+Title: AnalysisCache.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: on-disk cache of simGame analysis results
+		 keyed by a hash of the game's contents
+**************************************************/
+
+#ifndef ANALYSISCACHE_H
+#define ANALYSISCACHE_H
+
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+using namespace std;
+
+// results of analyzing one game; types holds null, zs, ih, pd, pc, bos, chicken, sh in that order
+struct CachedAnalysis
+{
+	vector<int> numStrats;
+	vector<string> payoffs; // every payoff written exactly, in the order they're hashed
+	vector<vector<int> > pureEquilibria;
+	vector<vector<int> > paretoPureEquilibria;
+	vector<bool> types;
+	vector<vector<int> > kStrategies; // 4 rationality levels, numPlayers strategies each
+};
+
+/*
+	One line per game:
+		hash numPlayers numStrats... numPayoffs payoffs... numEq eq... numPareto pareto... types... kStrategies...
+	Games are matched by hash, numStrats and payoffs, so a batch run can skip games
+	it has already analyzed and a hash collision is a miss, not another game's
+	results. New entries are only written by save().
+*/
+class AnalysisCache
+{
+	private:
+		string filename;
+		map<unsigned long long, CachedAnalysis> entries;
+		bool modified;
+
+		bool readEntry(istream &, CachedAnalysis &);
+		void writeEntry(ostream &, unsigned long long, const CachedAnalysis &) const;
+	public:
+		AnalysisCache(string f)	{ filename = f; modified = false; }
+
+		string getFilename() const	{ return filename; }
+		int getSize() const			{ return entries.size(); }
+		bool isModified() const		{ return modified; }
+
+		bool find(unsigned long long, const vector<int> &, const vector<string> &, CachedAnalysis &) const;
+		void insert(unsigned long long, const CachedAnalysis &);
+		bool load();
+		bool save();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// reads a count followed by that many profiles of numPlayers entries
+static bool readProfiles(istream &in, int numPlayers, vector<vector<int> > &profiles)
+{
+	int size = -1;
+	if (!(in >> size) || size < 0)
+		return false;
+	profiles = vector<vector<int> >(size, vector<int>(numPlayers));
+	for (int e = 0; e < size; e++)
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (!(in >> profiles.at(e).at(x)))
+				return false;
+		}
+	return true;
+}
+
+// returns true and fills result if a game with this hash, these strategy counts and these payoffs was analyzed
+bool AnalysisCache::find(unsigned long long hash, const vector<int> &numStrats, const vector<string> &payoffs, CachedAnalysis &result) const
+{
+	map<unsigned long long, CachedAnalysis>::const_iterator it = entries.find(hash);
+	if (it == entries.end() || it->second.numStrats != numStrats || it->second.payoffs != payoffs)
+		return false;
+	result = it->second;
+	return true;
+}
+
+void AnalysisCache::insert(unsigned long long hash, const CachedAnalysis &result)
+{
+	entries[hash] = result;
+	modified = true;
+}
+
+// a missing file is an empty cache; returns false only if the file is malformed
+bool AnalysisCache::load()
+{
+	ifstream inFile(filename.c_str());
+	if (!inFile)
+		return true;
+
+	unsigned long long hash = 0;
+	CachedAnalysis result;
+	while (inFile >> hash)
+	{
+		if (!readEntry(inFile, result))
+		{
+			cout << "ERROR: malformed entry in " << filename << endl;
+			return false;
+		}
+		entries[hash] = result;
+	}
+	modified = false;
+	return true;
+}
+
+bool AnalysisCache::readEntry(istream &in, CachedAnalysis &result)
+{
+	int numPlayers = -1;
+	if (!(in >> numPlayers) || numPlayers < 1)
+		return false;
+
+	result.numStrats = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		if (!(in >> result.numStrats.at(x)))
+			return false;
+	}
+
+	int numPayoffs = -1;
+	if (!(in >> numPayoffs) || numPayoffs < 0)
+		return false;
+	result.payoffs = vector<string>(numPayoffs);
+	for (int p = 0; p < numPayoffs; p++)
+	{
+		if (!(in >> result.payoffs.at(p)))
+			return false;
+	}
+
+	if (!readProfiles(in, numPlayers, result.pureEquilibria) || !readProfiles(in, numPlayers, result.paretoPureEquilibria))
+		return false;
+
+	result.types = vector<bool>(8);
+	for (int t = 0; t < 8; t++)
+	{
+		int flag = 0;
+		if (!(in >> flag))
+			return false;
+		result.types.at(t) = flag;
+	}
+
+	result.kStrategies = vector<vector<int> >(4, vector<int>(numPlayers));
+	for (int r = 0; r < 4; r++)
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (!(in >> result.kStrategies.at(r).at(x)))
+				return false;
+		}
+	return true;
+}
+
+// writes every entry back to filename
+bool AnalysisCache::save()
+{
+	ofstream outFile(filename.c_str());
+	if (!outFile)
+	{
+		cout << "ERROR: could not open " << filename << endl;
+		return false;
+	}
+	for (map<unsigned long long, CachedAnalysis>::const_iterator it = entries.begin(); it != entries.end(); it++)
+		writeEntry(outFile, it->first, it->second);
+	modified = false;
+	return true;
+}
+
+void AnalysisCache::writeEntry(ostream &out, unsigned long long hash, const CachedAnalysis &result) const
+{
+	int numPlayers = result.numStrats.size();
+
+	out << hash << " " << numPlayers;
+	for (int x = 0; x < numPlayers; x++)
+		out << " " << result.numStrats.at(x);
+
+	out << " " << result.payoffs.size();
+	for (int p = 0; (unsigned)p < result.payoffs.size(); p++)
+		out << " " << result.payoffs.at(p);
+
+	out << " " << result.pureEquilibria.size();
+	for (int e = 0; (unsigned)e < result.pureEquilibria.size(); e++)
+		for (int x = 0; x < numPlayers; x++)
+			out << " " << result.pureEquilibria.at(e).at(x);
+
+	out << " " << result.paretoPureEquilibria.size();
+	for (int e = 0; (unsigned)e < result.paretoPureEquilibria.size(); e++)
+		for (int x = 0; x < numPlayers; x++)
+			out << " " << result.paretoPureEquilibria.at(e).at(x);
+
+	for (int t = 0; (unsigned)t < result.types.size(); t++)
+		out << " " << result.types.at(t);
+
+	for (int r = 0; (unsigned)r < result.kStrategies.size(); r++)
+		for (int x = 0; x < numPlayers; x++)
+			out << " " << result.kStrategies.at(r).at(x);
+	out << "\n";
+}
+
+#endif
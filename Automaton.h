@@ -0,0 +1,183 @@
+/*************************************************
+Title: Automaton.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: finite automata playing repeated
+		 two-player games
+**************************************************/
+
+#ifndef AUTOMATON_H
+#define AUTOMATON_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+/*
+	Moore machine for a repeated game: each state plays one strategy, and after every
+	round the automaton moves to the state given by its current state and the
+	opponent's strategy. Its own strategy is fixed by the state, so this is enough to
+	react to the whole outcome of the round. The built-in automata are for 2x2 games
+	where s_1 is cooperating and s_2 is defecting, as in checkPDConditions().
+*/
+class Automaton
+{
+	private:
+		string name;
+		int numOpponentStrats;
+		int start;
+		vector<int> actions; // strategy played in each state
+		vector<int> transitions; // next state for each state and opponent strategy, state-major
+	public:
+		Automaton()
+		{
+			name = "";
+			numOpponentStrats = 2;
+			start = 0;
+		}
+
+		Automaton(string n, int numOpp)
+		{
+			name = n;
+			numOpponentStrats = numOpp;
+			start = 0;
+		}
+
+		int getAction(int q) const				{ return actions.at(q); }
+		string getName() const					{ return name; }
+		int getNext(int q, int opp) const		{ return transitions.at(q * numOpponentStrats + opp); }
+		int getNumOpponentStrats() const		{ return numOpponentStrats; }
+		int getNumStates() const				{ return actions.size(); }
+		int getStart() const					{ return start; }
+
+		void setName(string n)					{ name = n; }
+		void setStart(int q)					{ start = q; }
+		void setTransition(int q, int opp, int next)	{ transitions.at(q * numOpponentStrats + opp) = next; }
+
+		int addState(int);
+		bool isValid() const;
+		bool read(istream &);
+		void write(ostream &) const;
+
+		static Automaton alwaysCooperate();
+		static Automaton alwaysDefect();
+		static Automaton grim();
+		static Automaton pavlov();
+		static Automaton titForTat();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// adds a state playing strategy s that stays put until setTransition() says otherwise, returns its index
+int Automaton::addState(int s)
+{
+	int q = actions.size();
+	actions.push_back(s);
+	for (int opp = 0; opp < numOpponentStrats; opp++)
+		transitions.push_back(q);
+	return q;
+}
+
+Automaton Automaton::alwaysCooperate()
+{
+	Automaton a("AllC", 2);
+	a.addState(0);
+	return a;
+}
+
+Automaton Automaton::alwaysDefect()
+{
+	Automaton a("AllD", 2);
+	a.addState(1);
+	return a;
+}
+
+// cooperates until the opponent defects once, then defects forever
+Automaton Automaton::grim()
+{
+	Automaton a("Grim", 2);
+	int c = a.addState(0);
+	int d = a.addState(1);
+	a.setTransition(c, 1, d);
+	return a;
+}
+
+// every state plays a strategy and every transition leads to a state
+bool Automaton::isValid() const
+{
+	if (actions.empty() || start < 0 || start >= getNumStates())
+		return false;
+	for (int q = 0; (unsigned)q < transitions.size(); q++)
+	{
+		if (transitions.at(q) < 0 || transitions.at(q) >= getNumStates())
+			return false;
+	}
+	for (int q = 0; q < getNumStates(); q++)
+	{
+		if (actions.at(q) < 0)
+			return false;
+	}
+	return true;
+}
+
+// win-stay, lose-shift: keeps its move after (C, C) or (D, C) and switches after the other outcomes
+Automaton Automaton::pavlov()
+{
+	Automaton a("Pavlov", 2);
+	int c = a.addState(0);
+	int d = a.addState(1);
+	a.setTransition(c, 1, d);
+	a.setTransition(d, 1, c);
+	return a;
+}
+
+/*
+	name numStates numOpponentStrats start
+	then one line per state: strategy next state for each opponent strategy
+*/
+bool Automaton::read(istream &in)
+{
+	int numStates = 0;
+	if (!(in >> name >> numStates >> numOpponentStrats >> start) || numStates < 1 || numOpponentStrats < 1)
+		return false;
+
+	actions = vector<int>(numStates);
+	transitions = vector<int>(numStates * numOpponentStrats);
+	for (int q = 0; q < numStates; q++)
+	{
+		if (!(in >> actions.at(q)))
+			return false;
+		for (int opp = 0; opp < numOpponentStrats; opp++)
+		{
+			if (!(in >> transitions.at(q * numOpponentStrats + opp)))
+				return false;
+		}
+	}
+	return isValid();
+}
+
+// cooperates first, then copies the opponent's last move
+Automaton Automaton::titForTat()
+{
+	Automaton a("TFT", 2);
+	int c = a.addState(0);
+	int d = a.addState(1);
+	a.setTransition(c, 1, d);
+	a.setTransition(d, 0, c);
+	return a;
+}
+
+void Automaton::write(ostream &out) const
+{
+	out << name << " " << getNumStates() << " " << numOpponentStrats << " " << start << endl;
+	for (int q = 0; q < getNumStates(); q++)
+	{
+		out << actions.at(q);
+		for (int opp = 0; opp < numOpponentStrats; opp++)
+			out << " " << getNext(q, opp);
+		out << endl;
+	}
+}
+
+#endif
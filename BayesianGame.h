@@ -0,0 +1,424 @@
+/*************************************************
+Title: BayesianGame.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: games of incomplete information with
+		 types, and pure Bayes-Nash equilibria
+**************************************************/
+
+#ifndef BAYESIANGAME_H
+#define BAYESIANGAME_H
+
+#include <algorithm>
+#include <cmath>
+#include "SimGame.h"
+
+/*
+	Every player has a type drawn independently from their own distribution and known
+	only to them, and each profile of types has its own payoff tensor. A strategy gives
+	a strategy for every type, so strategies.at(x).at(t) is what P_x plays as type t.
+
+	The agent form treats each (player, type) as a separate player whose payoff is their
+	expected payoff given their type. It's never built: getAgentPayoff() works it out for
+	one agent profile when asked. Best responses split by type, since what P_x plays as
+	one type doesn't change their payoff as another. So the equilibrium search only
+	enumerates every other player's strategies, gives the remaining player a best
+	response per type, and combines those.
+*/
+template <typename T>
+class BayesianGame
+{
+	private:
+		int numPlayers;
+		int numOutcomes; // strategy profiles, P_1's strategy fastest
+		int numTypeProfiles; // type profiles, P_1's type fastest
+		vector<int> numStrats;
+		vector<int> numTypes;
+		vector<int> outcomeStrides;
+		vector<int> typeStrides;
+		vector<int> agentStarts; // index of each player's first agent
+		vector<vector<double> > typeProbs;
+		vector<vector<T> > payoffs; // payoffs.at(type profile).at(outcome * numPlayers + x)
+
+		vector<double> computeTypePayoffs(const vector<vector<int> > &, int, int) const;
+		int outcome(const vector<int> &) const;
+		int typeProfile(const vector<int> &) const;
+	public:
+		BayesianGame(const vector<int> &, const vector<int> &);
+
+		int getNumAgents() const						{ return agentStarts.back(); }
+		int getNumPlayers() const						{ return numPlayers; }
+		int getNumStrats(int x) const					{ return numStrats.at(x); }
+		int getNumTypes(int x) const					{ return numTypes.at(x); }
+		double getTypeProb(int x, int t) const			{ return typeProbs.at(x).at(t); }
+
+		vector<int> computeBestResponses(const vector<vector<int> > &, int, int) const;
+		vector<vector<vector<int> > > computePureBayesNashEquilibria(int) const;
+		double getAgentPayoff(const vector<int> &, int) const;
+		T getPayoff(const vector<int> &, const vector<int> &, int) const;
+		bool isBayesNashEquilibrium(const vector<vector<int> > &) const;
+		void printPureBayesNashEquilibria(int) const;
+		void randGame();
+		void setPayoff(const vector<int> &, const vector<int> &, int, T);
+		bool setTypeGame(const vector<int> &, simGame<T>*);
+		bool setTypeProbs(int, const vector<double> &);
+		void updateKnowledge(simGame<T>*) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, numbers of strategies and types per player; types start uniform and payoffs at 0
+template <typename T>
+BayesianGame<T>::BayesianGame(const vector<int> &nS, const vector<int> &nT)
+{
+	numPlayers = nS.size();
+	numStrats = nS;
+	numTypes = nT;
+	numOutcomes = 1;
+	numTypeProfiles = 1;
+	agentStarts = vector<int>(1, 0);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		outcomeStrides.push_back(numOutcomes);
+		typeStrides.push_back(numTypeProfiles);
+		numOutcomes *= numStrats.at(x);
+		numTypeProfiles *= numTypes.at(x);
+		agentStarts.push_back(agentStarts.back() + numTypes.at(x));
+		typeProbs.push_back(vector<double>(numTypes.at(x), 1.0 / numTypes.at(x)));
+	}
+	payoffs = vector<vector<T> >(numTypeProfiles, vector<T>(numOutcomes * numPlayers, T(0)));
+}
+
+// P_x's best responses as type t to everyone else's strategies
+template <typename T>
+vector<int> BayesianGame<T>::computeBestResponses(const vector<vector<int> > &strategies, int x, int t) const
+{
+	vector<double> expected = computeTypePayoffs(strategies, x, t);
+	vector<int> best;
+	double maxPayoff = expected.at(0);
+
+	for (int s = 1; s < numStrats.at(x); s++)
+	{
+		if (expected.at(s) > maxPayoff)
+			maxPayoff = expected.at(s);
+	}
+	for (int s = 0; s < numStrats.at(x); s++)
+	{
+		if (expected.at(s) >= maxPayoff - 1e-9 * max(1.0, fabs(maxPayoff)))
+			best.push_back(s);
+	}
+	return best;
+}
+
+/*
+	Up to maxEquilibria pure Bayes-Nash equilibria. The player with the most strategies
+	(counting one strategy per type) is left out of the enumeration; for each strategy
+	of the others, their best responses are found type by type, and every combination
+	is checked against the others' agents. The cost is exponential in the other players'
+	agents, but not in the left-out player's.
+*/
+template <typename T>
+vector<vector<vector<int> > > BayesianGame<T>::computePureBayesNashEquilibria(int maxEquilibria) const
+{
+	vector<vector<vector<int> > > equilibria;
+	vector<vector<int> > strategies = vector<vector<int> >(numPlayers);
+	int left = 0;
+
+	for (int x = 0; x < numPlayers; x++)
+	{
+		strategies.at(x) = vector<int>(numTypes.at(x), 0);
+		if (numTypes.at(x) * log((double)numStrats.at(x)) > numTypes.at(left) * log((double)numStrats.at(left)))
+			left = x;
+	}
+
+	while ((int)equilibria.size() < maxEquilibria)
+	{
+		// left's best responses, type by type
+		vector<vector<int> > best = vector<vector<int> >(numTypes.at(left));
+		for (int t = 0; t < numTypes.at(left); t++)
+			best.at(t) = computeBestResponses(strategies, left, t);
+
+		vector<int> choice = vector<int>(numTypes.at(left), 0);
+		while ((int)equilibria.size() < maxEquilibria)
+		{
+			for (int t = 0; t < numTypes.at(left); t++)
+				strategies.at(left).at(t) = best.at(t).at(choice.at(t));
+
+			bool equilibrium = true;
+			for (int x = 0; x < numPlayers && equilibrium; x++)
+			{
+				if (x == left)
+					continue;
+				for (int t = 0; t < numTypes.at(x) && equilibrium; t++)
+				{
+					vector<double> expected = computeTypePayoffs(strategies, x, t);
+					double current = expected.at(strategies.at(x).at(t));
+					for (int s = 0; s < numStrats.at(x); s++)
+					{
+						if (expected.at(s) > current + 1e-9 * max(1.0, fabs(current)))
+						{
+							equilibrium = false;
+							break;
+						}
+					}
+				}
+			}
+			if (equilibrium)
+				equilibria.push_back(strategies);
+
+			int t = 0;
+			while (t < numTypes.at(left) && choice.at(t) == (int)best.at(t).size() - 1)
+			{
+				choice.at(t) = 0;
+				t++;
+			}
+			if (t == numTypes.at(left))
+				break;
+			choice.at(t)++;
+		}
+
+		// next strategies for everyone but left
+		int x = 0, t = 0;
+		while (x < numPlayers)
+		{
+			if (x == left || t == numTypes.at(x))
+			{
+				x++;
+				t = 0;
+				continue;
+			}
+			if (strategies.at(x).at(t) < numStrats.at(x) - 1)
+				break;
+			strategies.at(x).at(t) = 0;
+			t++;
+		}
+		if (x == numPlayers)
+			break;
+		strategies.at(x).at(t)++;
+	}
+	return equilibria;
+}
+
+/*
+	Expected payoff of each of P_x's strategies as type t, with everyone else playing
+	their strategies: a sum over the others' type profiles weighted by their
+	probabilities
+*/
+template <typename T>
+vector<double> BayesianGame<T>::computeTypePayoffs(const vector<vector<int> > &strategies, int x, int t) const
+{
+	vector<double> expected = vector<double>(numStrats.at(x), 0.0);
+	vector<int> types = vector<int>(numPlayers, 0);
+
+	types.at(x) = t;
+	while (true)
+	{
+		double probability = 1.0;
+		int base = 0;
+		for (int y = 0; y < numPlayers; y++)
+		{
+			if (y == x)
+				continue;
+			probability *= typeProbs.at(y).at(types.at(y));
+			base += strategies.at(y).at(types.at(y)) * outcomeStrides.at(y);
+		}
+		if (probability > 0.0)
+		{
+			const vector<T> &typePayoffs = payoffs.at(typeProfile(types));
+			for (int s = 0; s < numStrats.at(x); s++)
+				expected.at(s) += probability * static_cast<double>(typePayoffs.at((base + s * outcomeStrides.at(x)) * numPlayers + x));
+		}
+
+		int y = 0;
+		while (y < numPlayers && (y == x || types.at(y) == numTypes.at(y) - 1))
+		{
+			if (y != x)
+				types.at(y) = 0;
+			y++;
+		}
+		if (y == numPlayers)
+			break;
+		types.at(y)++;
+	}
+	return expected;
+}
+
+/*
+	Payoff of one agent in the agent form, its player's expected payoff given its type.
+	Agents are numbered by player and then type, and agentProfile has a strategy for
+	each of them.
+*/
+template <typename T>
+double BayesianGame<T>::getAgentPayoff(const vector<int> &agentProfile, int agent) const
+{
+	vector<vector<int> > strategies = vector<vector<int> >(numPlayers);
+	int x = 0;
+
+	for (int y = 0; y < numPlayers; y++)
+		strategies.at(y) = vector<int>(agentProfile.begin() + agentStarts.at(y), agentProfile.begin() + agentStarts.at(y + 1));
+	while (agentStarts.at(x + 1) <= agent)
+		x++;
+	int t = agent - agentStarts.at(x);
+	return computeTypePayoffs(strategies, x, t).at(strategies.at(x).at(t));
+}
+
+template <typename T>
+T BayesianGame<T>::getPayoff(const vector<int> &types, const vector<int> &profile, int x) const
+{
+	return payoffs.at(typeProfile(types)).at(outcome(profile) * numPlayers + x);
+}
+
+// every agent is best responding
+template <typename T>
+bool BayesianGame<T>::isBayesNashEquilibrium(const vector<vector<int> > &strategies) const
+{
+	for (int x = 0; x < numPlayers; x++)
+		for (int t = 0; t < numTypes.at(x); t++)
+		{
+			vector<int> best = computeBestResponses(strategies, x, t);
+			if (find(best.begin(), best.end(), strategies.at(x).at(t)) == best.end())
+				return false;
+		}
+	return true;
+}
+
+template <typename T>
+int BayesianGame<T>::outcome(const vector<int> &profile) const
+{
+	int o = 0;
+	for (int x = 0; x < numPlayers; x++)
+		o += profile.at(x) * outcomeStrides.at(x);
+	return o;
+}
+
+/*
+	Pure Bayes-Nash Equilibria:
+	P_1: t_1 s_2, t_2 s_1 | P_2: t_1 s_1
+*/
+template <typename T>
+void BayesianGame<T>::printPureBayesNashEquilibria(int maxEquilibria) const
+{
+	vector<vector<vector<int> > > equilibria = computePureBayesNashEquilibria(maxEquilibria);
+
+	cout << "\nPure Bayes-Nash Equilibria:\n";
+	if (equilibria.empty())
+		cout << "none\n";
+	for (int e = 0; (unsigned)e < equilibria.size(); e++)
+	{
+		for (int x = 0; x < numPlayers; x++)
+		{
+			cout << "P_" << x + 1 << ":";
+			for (int t = 0; t < numTypes.at(x); t++)
+			{
+				cout << " t_" << t + 1 << " s_" << equilibria.at(e).at(x).at(t) + 1;
+				if (t < numTypes.at(x) - 1)
+					cout << ",";
+			}
+			if (x < numPlayers - 1)
+				cout << " | ";
+		}
+		cout << endl;
+	}
+}
+
+// payoffs from 0 to 99 for every type profile, like simGame::randGame()
+template <typename T>
+void BayesianGame<T>::randGame()
+{
+	for (int tp = 0; tp < numTypeProfiles; tp++)
+		for (int i = 0; (unsigned)i < payoffs.at(tp).size(); i++)
+			payoffs.at(tp).at(i) = rand() % 100;
+}
+
+template <typename T>
+void BayesianGame<T>::setPayoff(const vector<int> &types, const vector<int> &profile, int x, T value)
+{
+	payoffs.at(typeProfile(types)).at(outcome(profile) * numPlayers + x) = value;
+}
+
+// copies a simGame's payoffs as the game played when the types are these
+template <typename T>
+bool BayesianGame<T>::setTypeGame(const vector<int> &types, simGame<T>* game)
+{
+	if (game->getNumPlayers() != numPlayers)
+	{
+		cout << "ERROR: the game needs " << numPlayers << " players\n";
+		return false;
+	}
+	GameFeatures<T> features = game->computeFeatures();
+	for (int x = 0; x < numPlayers; x++)
+	{
+		if (features.getNumStrats(x) != numStrats.at(x))
+		{
+			cout << "ERROR: P_" << x + 1 << " needs " << numStrats.at(x) << " strategies\n";
+			return false;
+		}
+	}
+
+	// GameFeatures also numbers outcomes with P_1's strategy fastest
+	vector<T> &typePayoffs = payoffs.at(typeProfile(types));
+	for (int o = 0; o < numOutcomes; o++)
+		for (int x = 0; x < numPlayers; x++)
+			typePayoffs.at(o * numPlayers + x) = features.getPayoff(o, x);
+	return true;
+}
+
+// probs.at(t) is the probability P_x is type t
+template <typename T>
+bool BayesianGame<T>::setTypeProbs(int x, const vector<double> &probs)
+{
+	double total = 0.0;
+	for (int t = 0; (unsigned)t < probs.size(); t++)
+	{
+		if (probs.at(t) < 0.0)
+		{
+			cout << "ERROR: probabilities can't be negative\n";
+			return false;
+		}
+		total += probs.at(t);
+	}
+	if ((int)probs.size() != numTypes.at(x) || fabs(total - 1.0) > 1e-9)
+	{
+		cout << "ERROR: P_" << x + 1 << " needs " << numTypes.at(x) << " probabilities adding up to 1\n";
+		return false;
+	}
+	typeProbs.at(x) = probs;
+	return true;
+}
+
+template <typename T>
+int BayesianGame<T>::typeProfile(const vector<int> &types) const
+{
+	int tp = 0;
+	for (int x = 0; x < numPlayers; x++)
+		tp += types.at(x) * typeStrides.at(x);
+	return tp;
+}
+
+/*
+	Records in every player's Knowledge of a simGame with the same players that types
+	are private: nobody else knows the payoffs or preferences of a player with more than
+	one type. The prior is common knowledge, so everyone agrees on this.
+*/
+template <typename T>
+void BayesianGame<T>::updateKnowledge(simGame<T>* game) const
+{
+	if (game->getNumPlayers() != numPlayers)
+	{
+		cout << "ERROR: the game needs " << numPlayers << " players\n";
+		return;
+	}
+	for (int z = 0; z < numPlayers; z++)
+	{
+		Knowledge* knowledge = game->getPlayer(z)->getKnowledge();
+		for (int x = 0; x < numPlayers; x++)
+			for (int y = 0; y < numPlayers; y++)
+			{
+				bool known = (x == y || numTypes.at(y) == 1);
+				knowledge->setpayoffKnowledge(x, y, known);
+				knowledge->setpreferenceKnowledge(x, y, known);
+			}
+	}
+}
+
+#endif
@@ -0,0 +1,390 @@
+/*************************************************
+Title: BigInt.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: arbitrary-precision integers for the
+		 numerators and denominators in Rational.h
+**************************************************/
+
+#ifndef BIGINT_H
+#define BIGINT_H
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+/*
+	sign and magnitude, the magnitude in base 2^32 with the least significant digit
+	first and no leading 0s, so 0 has no digits. Division is Knuth's algorithm D
+	and truncates toward 0 like / and % on ints.
+*/
+class BigInt
+{
+	private:
+		bool negative;
+		vector<unsigned int> digits;
+
+		static int compareMagnitudes(const vector<unsigned int> &, const vector<unsigned int> &);
+		static vector<unsigned int> addMagnitudes(const vector<unsigned int> &, const vector<unsigned int> &);
+		static void divideMagnitudes(const vector<unsigned int> &, const vector<unsigned int> &, vector<unsigned int> &, vector<unsigned int> &);
+		static vector<unsigned int> multiplyMagnitudes(const vector<unsigned int> &, const vector<unsigned int> &);
+		static vector<unsigned int> subtractMagnitudes(const vector<unsigned int> &, const vector<unsigned int> &);
+		static void trim(vector<unsigned int> &);
+	public:
+		BigInt(long long n = 0);
+
+		bool isNegative() const		{ return negative; }
+		bool isZero() const			{ return digits.empty(); }
+		int getNumDigits() const	{ return digits.size(); }
+
+		BigInt operator+(const BigInt &) const;
+		BigInt operator-(const BigInt &) const;
+		BigInt operator*(const BigInt &) const;
+		BigInt operator/(const BigInt &) const;
+		BigInt operator%(const BigInt &) const;
+		BigInt operator-() const;
+		bool operator==(const BigInt &b) const	{ return negative == b.negative && digits == b.digits; }
+		bool operator!=(const BigInt &b) const	{ return !(*this == b); }
+		bool operator<(const BigInt &) const;
+		bool operator>(const BigInt &b) const	{ return b < *this; }
+		bool operator<=(const BigInt &b) const	{ return !(b < *this); }
+		bool operator>=(const BigInt &b) const	{ return !(*this < b); }
+
+		BigInt abs() const;
+		static void divide(const BigInt &, const BigInt &, BigInt &, BigInt &);
+		static BigInt gcd(BigInt, BigInt);
+		double toDouble(int &) const;
+		string toString() const;
+
+		friend ostream& operator << (ostream& os, const BigInt& b)	{ return os << b.toString(); }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor
+BigInt::BigInt(long long n)
+{
+	negative = n < 0;
+	unsigned long long magnitude = negative ? 0ULL - (unsigned long long)n : (unsigned long long)n;
+	while (magnitude > 0)
+	{
+		digits.push_back((unsigned int)magnitude);
+		magnitude >>= 32;
+	}
+}
+
+BigInt BigInt::operator+(const BigInt &b) const
+{
+	BigInt sum;
+	if (negative == b.negative)
+	{
+		sum.digits = addMagnitudes(digits, b.digits);
+		sum.negative = negative;
+	}
+	else if (compareMagnitudes(digits, b.digits) >= 0)
+	{
+		sum.digits = subtractMagnitudes(digits, b.digits);
+		sum.negative = negative;
+	}
+	else
+	{
+		sum.digits = subtractMagnitudes(b.digits, digits);
+		sum.negative = b.negative;
+	}
+	if (sum.digits.empty())
+		sum.negative = false;
+	return sum;
+}
+
+BigInt BigInt::operator-(const BigInt &b) const
+{
+	return *this + (-b);
+}
+
+BigInt BigInt::operator*(const BigInt &b) const
+{
+	BigInt product;
+	product.digits = multiplyMagnitudes(digits, b.digits);
+	product.negative = !product.digits.empty() && negative != b.negative;
+	return product;
+}
+
+BigInt BigInt::operator/(const BigInt &b) const
+{
+	BigInt quotient, remainder;
+	divide(*this, b, quotient, remainder);
+	return quotient;
+}
+
+BigInt BigInt::operator%(const BigInt &b) const
+{
+	BigInt quotient, remainder;
+	divide(*this, b, quotient, remainder);
+	return remainder;
+}
+
+BigInt BigInt::operator-() const
+{
+	BigInt b = *this;
+	b.negative = !b.digits.empty() && !negative;
+	return b;
+}
+
+bool BigInt::operator<(const BigInt &b) const
+{
+	if (negative != b.negative)
+		return negative;
+	int comparison = compareMagnitudes(digits, b.digits);
+	return negative ? comparison > 0 : comparison < 0;
+}
+
+BigInt BigInt::abs() const
+{
+	BigInt b = *this;
+	b.negative = false;
+	return b;
+}
+
+vector<unsigned int> BigInt::addMagnitudes(const vector<unsigned int> &a, const vector<unsigned int> &b)
+{
+	const vector<unsigned int> &longer = (a.size() >= b.size()) ? a : b;
+	const vector<unsigned int> &shorter = (a.size() >= b.size()) ? b : a;
+	vector<unsigned int> sum = vector<unsigned int>(longer.size() + 1);
+	unsigned long long carry = 0;
+
+	for (int i = 0; (unsigned)i < longer.size(); i++)
+	{
+		carry += longer.at(i);
+		if ((unsigned)i < shorter.size())
+			carry += shorter.at(i);
+		sum.at(i) = (unsigned int)carry;
+		carry >>= 32;
+	}
+	sum.back() = (unsigned int)carry;
+	trim(sum);
+	return sum;
+}
+
+// -1, 0 or 1 as |a| is less than, equal to or greater than |b|
+int BigInt::compareMagnitudes(const vector<unsigned int> &a, const vector<unsigned int> &b)
+{
+	if (a.size() != b.size())
+		return (a.size() < b.size()) ? -1 : 1;
+	for (int i = a.size() - 1; i >= 0; i--)
+	{
+		if (a.at(i) != b.at(i))
+			return (a.at(i) < b.at(i)) ? -1 : 1;
+	}
+	return 0;
+}
+
+// quotient and remainder of a / b, both truncated toward 0, so the remainder has the sign of a
+void BigInt::divide(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder)
+{
+	if (b.isZero())
+	{
+		cout << "ERROR: division by 0\n";
+		quotient = BigInt(0);
+		remainder = BigInt(0);
+		return;
+	}
+	divideMagnitudes(a.digits, b.digits, quotient.digits, remainder.digits);
+	quotient.negative = !quotient.digits.empty() && a.negative != b.negative;
+	remainder.negative = !remainder.digits.empty() && a.negative;
+}
+
+/*
+	Knuth's algorithm D: both numbers are shifted so the divisor's top digit has its
+	high bit set, and then each estimate of a quotient digit from the top two digits
+	of the remainder is at most 2 too big.
+*/
+void BigInt::divideMagnitudes(const vector<unsigned int> &u, const vector<unsigned int> &v, vector<unsigned int> &quotient, vector<unsigned int> &remainder)
+{
+	const unsigned long long base = 1ULL << 32;
+	int m = u.size();
+	int n = v.size();
+
+	if (compareMagnitudes(u, v) < 0)
+	{
+		quotient.clear();
+		remainder = u;
+		return;
+	}
+
+	quotient = vector<unsigned int>(m - n + 1, 0);
+	if (n == 1)
+	{
+		unsigned long long rem = 0;
+		for (int j = m - 1; j >= 0; j--)
+		{
+			unsigned long long cur = (rem << 32) | u.at(j);
+			quotient.at(j) = (unsigned int)(cur / v.at(0));
+			rem = cur % v.at(0);
+		}
+		remainder.clear();
+		if (rem > 0)
+			remainder.push_back((unsigned int)rem);
+		trim(quotient);
+		return;
+	}
+
+	int shift = 0;
+	while (!((v.back() << shift) & 0x80000000U))
+		shift++;
+	vector<unsigned int> vn = vector<unsigned int>(n);
+	vector<unsigned int> un = vector<unsigned int>(m + 1);
+	for (int i = n - 1; i > 0; i--)
+		vn.at(i) = (v.at(i) << shift) | (shift ? v.at(i - 1) >> (32 - shift) : 0);
+	vn.at(0) = v.at(0) << shift;
+	un.at(m) = shift ? u.at(m - 1) >> (32 - shift) : 0;
+	for (int i = m - 1; i > 0; i--)
+		un.at(i) = (u.at(i) << shift) | (shift ? u.at(i - 1) >> (32 - shift) : 0);
+	un.at(0) = u.at(0) << shift;
+
+	for (int j = m - n; j >= 0; j--)
+	{
+		unsigned long long top = ((unsigned long long)un.at(j + n) << 32) | un.at(j + n - 1);
+		unsigned long long qhat = top / vn.at(n - 1);
+		unsigned long long rhat = top % vn.at(n - 1);
+		while (qhat >= base || qhat * vn.at(n - 2) > ((rhat << 32) | un.at(j + n - 2)))
+		{
+			qhat--;
+			rhat += vn.at(n - 1);
+			if (rhat >= base)
+				break;
+		}
+
+		// un[j..j+n] -= qhat * vn
+		long long borrow = 0;
+		long long t;
+		for (int i = 0; i < n; i++)
+		{
+			unsigned long long p = qhat * vn.at(i);
+			t = (long long)un.at(i + j) - borrow - (long long)(p & 0xFFFFFFFFULL);
+			un.at(i + j) = (unsigned int)t;
+			borrow = (long long)(p >> 32) - (t >> 32);
+		}
+		t = (long long)un.at(j + n) - borrow;
+		un.at(j + n) = (unsigned int)t;
+
+		// qhat was 1 too big, so add vn back
+		quotient.at(j) = (unsigned int)qhat;
+		if (t < 0)
+		{
+			quotient.at(j)--;
+			unsigned long long carry = 0;
+			for (int i = 0; i < n; i++)
+			{
+				carry += (unsigned long long)un.at(i + j) + vn.at(i);
+				un.at(i + j) = (unsigned int)carry;
+				carry >>= 32;
+			}
+			un.at(j + n) += (unsigned int)carry;
+		}
+	}
+
+	remainder = vector<unsigned int>(n);
+	for (int i = 0; i < n; i++)
+		remainder.at(i) = (un.at(i) >> shift) | (shift ? un.at(i + 1) << (32 - shift) : 0);
+	trim(quotient);
+	trim(remainder);
+}
+
+// nonnegative greatest common divisor, 0 only if both are 0
+BigInt BigInt::gcd(BigInt a, BigInt b)
+{
+	a.negative = false;
+	b.negative = false;
+	while (!b.isZero())
+	{
+		BigInt quotient, remainder;
+		divide(a, b, quotient, remainder);
+		a = b;
+		b = remainder;
+	}
+	return a;
+}
+
+vector<unsigned int> BigInt::multiplyMagnitudes(const vector<unsigned int> &a, const vector<unsigned int> &b)
+{
+	if (a.empty() || b.empty())
+		return vector<unsigned int>();
+
+	vector<unsigned int> product = vector<unsigned int>(a.size() + b.size(), 0);
+	for (int i = 0; (unsigned)i < a.size(); i++)
+	{
+		unsigned long long carry = 0;
+		for (int j = 0; (unsigned)j < b.size(); j++)
+		{
+			carry += (unsigned long long)a.at(i) * b.at(j) + product.at(i + j);
+			product.at(i + j) = (unsigned int)carry;
+			carry >>= 32;
+		}
+		product.at(i + b.size()) = (unsigned int)carry;
+	}
+	trim(product);
+	return product;
+}
+
+// |a| - |b| for |a| >= |b|
+vector<unsigned int> BigInt::subtractMagnitudes(const vector<unsigned int> &a, const vector<unsigned int> &b)
+{
+	vector<unsigned int> difference = vector<unsigned int>(a.size());
+	long long borrow = 0;
+
+	for (int i = 0; (unsigned)i < a.size(); i++)
+	{
+		long long cur = (long long)a.at(i) - borrow - ((unsigned)i < b.size() ? (long long)b.at(i) : 0);
+		borrow = (cur < 0) ? 1 : 0;
+		difference.at(i) = (unsigned int)(cur + (borrow << 32));
+	}
+	trim(difference);
+	return difference;
+}
+
+/*
+	the top 3 digits as a double times 2^exponent, so a ratio of two huge numbers
+	can be taken without going through infinity
+*/
+double BigInt::toDouble(int &exponent) const
+{
+	int low = (digits.size() > 3) ? digits.size() - 3 : 0;
+	double val = 0;
+
+	for (int i = digits.size() - 1; i >= low; i--)
+		val = val * 4294967296.0 + digits.at(i);
+	exponent = 32 * low;
+	return negative ? -val : val;
+}
+
+string BigInt::toString() const
+{
+	if (digits.empty())
+		return "0";
+
+	// peel off 9 decimal digits at a time
+	vector<unsigned int> rest = digits;
+	vector<unsigned int> billion = vector<unsigned int>(1, 1000000000U);
+	string str;
+	while (!rest.empty())
+	{
+		vector<unsigned int> quotient, remainder;
+		divideMagnitudes(rest, billion, quotient, remainder);
+		string chunk = to_string(remainder.empty() ? 0U : remainder.at(0));
+		if (!quotient.empty())
+			chunk = string(9 - chunk.size(), '0') + chunk;
+		str = chunk + str;
+		rest = quotient;
+	}
+	return negative ? "-" + str : str;
+}
+
+void BigInt::trim(vector<unsigned int> &magnitude)
+{
+	while (!magnitude.empty() && magnitude.back() == 0)
+		magnitude.pop_back();
+}
+
+#endif
@@ -0,0 +1,168 @@
+/*************************************************
+Title: BitMatrix.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: square Boolean matrices packed into
+		 64-bit words
+**************************************************/
+
+#ifndef BITMATRIX_H
+#define BITMATRIX_H
+
+#include <vector>
+using namespace std;
+
+/*
+	Row x is numWords consecutive words, bit y of the row in word y / 64. Setting a whole
+	row, comparing matrices and the Boolean product all work a word at a time, so
+	a product of n x n matrices is at most n^2 row ORs of n / 64 words each.
+*/
+class BitMatrix
+{
+	private:
+		int size;
+		int numWords; // words per row
+		vector<unsigned long long> bits;
+
+		unsigned long long lastWordMask(int) const;
+	public:
+		BitMatrix(int n = 0)
+		{
+			size = n;
+			numWords = (n + 63) / 64;
+			bits = vector<unsigned long long>(size * numWords, 0);
+		}
+
+		bool operator==(const BitMatrix &other) const	{ return size == other.size && bits == other.bits; }
+		bool operator!=(const BitMatrix &other) const	{ return !(*this == other); }
+
+		bool get(int x, int y) const				{ return (bits.at(x * numWords + y / 64) >> (y % 64)) & 1; }
+		const unsigned long long* getRow(int x) const	{ return &bits.at(x * numWords); }
+		int getSize() const							{ return size; }
+
+		BitMatrix closure() const;
+		static BitMatrix identity(int);
+		bool isColumnFull(int) const;
+		bool isFull() const;
+		BitMatrix multiply(const BitMatrix &) const;
+		void set(int, int, bool);
+		void setAll(bool);
+		void setRow(int, const unsigned long long*);
+		void unite(const BitMatrix &);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+	Reflexive-transitive closure: x reaches y along any chain of 1s. Squaring I | A
+	doubles the chain lengths covered, so it's done after about log2(n) products.
+*/
+BitMatrix BitMatrix::closure() const
+{
+	BitMatrix reach = identity(size);
+	reach.unite(*this);
+
+	while (true)
+	{
+		BitMatrix next = reach.multiply(reach);
+		if (next == reach)
+			return reach;
+		reach = next;
+	}
+}
+
+BitMatrix BitMatrix::identity(int n)
+{
+	BitMatrix m = BitMatrix(n);
+	for (int x = 0; x < n; x++)
+		m.set(x, x, true);
+	return m;
+}
+
+// every row has a 1 in column y
+bool BitMatrix::isColumnFull(int y) const
+{
+	for (int x = 0; x < size; x++)
+	{
+		if (!get(x, y))
+			return false;
+	}
+	return true;
+}
+
+bool BitMatrix::isFull() const
+{
+	for (int x = 0; x < size; x++)
+	{
+		for (int w = 0; w < numWords; w++)
+		{
+			if (bits.at(x * numWords + w) != lastWordMask(w))
+				return false;
+		}
+	}
+	return true;
+}
+
+// the bits of word w of a row that are inside the matrix
+unsigned long long BitMatrix::lastWordMask(int w) const
+{
+	if (w < numWords - 1 || size % 64 == 0)
+		return ~0ULL;
+	return (1ULL << (size % 64)) - 1;
+}
+
+// Boolean product: row x of the result is the OR of other's rows y for the 1s in row x
+BitMatrix BitMatrix::multiply(const BitMatrix &other) const
+{
+	BitMatrix product = BitMatrix(size);
+
+	for (int x = 0; x < size; x++)
+	{
+		unsigned long long* row = &product.bits.at(x * numWords);
+		for (int w = 0; w < numWords; w++)
+		{
+			// shifts stop once the rest of the word is 0s
+			int y = w * 64;
+			for (unsigned long long word = bits.at(x * numWords + w); word; word >>= 1, y++)
+			{
+				if (!(word & 1))
+					continue;
+				const unsigned long long* otherRow = &other.bits.at(y * numWords);
+				for (int v = 0; v < numWords; v++)
+					row[v] |= otherRow[v];
+			}
+		}
+	}
+	return product;
+}
+
+void BitMatrix::set(int x, int y, bool val)
+{
+	if (val)
+		bits.at(x * numWords + y / 64) |= 1ULL << (y % 64);
+	else
+		bits.at(x * numWords + y / 64) &= ~(1ULL << (y % 64));
+}
+
+void BitMatrix::setAll(bool val)
+{
+	for (int x = 0; x < size; x++)
+		for (int w = 0; w < numWords; w++)
+			bits.at(x * numWords + w) = val ? lastWordMask(w) : 0;
+}
+
+// row x becomes numWords words copied from row
+void BitMatrix::setRow(int x, const unsigned long long* row)
+{
+	for (int w = 0; w < numWords; w++)
+		bits.at(x * numWords + w) = row[w];
+}
+
+// OR with other
+void BitMatrix::unite(const BitMatrix &other)
+{
+	for (int n = 0; (unsigned)n < bits.size(); n++)
+		bits.at(n) |= other.bits.at(n);
+}
+
+#endif
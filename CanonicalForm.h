@@ -0,0 +1,420 @@
+/*******************************************************
+Title: CanonicalForm.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: ordinal canonical form and isomorphism hash for
+		 deduplicating games and numbering strict 2x2 games
+********************************************************/
+
+#ifndef CANONICALFORM_H
+#define CANONICALFORM_H
+#include "GameFeatures.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+/*
+	Two games are in the same class if one can be turned into the other by
+	relabeling strategies, relabeling players with the same number of
+	strategies, and monotone transformations of each player's payoffs.
+
+	The canonical form replaces payoffs with each player's ordinal ranks
+	(GameFeatures), then takes the lexicographically smallest rank vector over
+	every strategy and player relabeling. The search is exhaustive
+	(n_1! * ... * n_N! relabelings of strategies), so it's meant for the small
+	games gt works with. Ranks use the same flat layout as GameFeatures.
+*/
+class CanonicalForm
+{
+	private:
+		int numPlayers;
+		int numOutcomes;
+		vector<int> numStrats; // sorted, players with fewer strategies first
+		vector<int> ranks; // ranks.at(o * numPlayers + x)
+		unsigned long long hashValue;
+
+		// relabeling that produced the canonical form
+		vector<int> playerPerm; // canonical player k is original player playerPerm.at(k)
+		vector<vector<int> > stratPerms; // original strategy s of P_x becomes stratPerms.at(x).at(s)
+		vector<int> originalNumStrats;
+		vector<int> originalRanks;
+
+		// strict ordinal 2x2 games
+		bool strictOrdinal2x2;
+		int strict2x2Index;
+		int strict2x2Class;
+		bool symmetric2x2;
+
+		void computeHash();
+		void compute2x2Taxonomy();
+		int index2x2(const vector<int> &) const;
+		bool isSymmetricUnder(int) const;
+		vector<int> relabel(const vector<int> &, const vector<vector<int> > &) const;
+		void search(int, vector<vector<int> > &, vector<int> &);
+	public:
+		template <typename T>
+		CanonicalForm(const GameFeatures<T> &);
+		CanonicalForm(const vector<int> &, const vector<int> &);
+
+		unsigned long long getHash() const		{ return hashValue; }
+		int getNumPlayers() const				{ return numPlayers; }
+		int getNumStrats(int x) const			{ return numStrats.at(x); }
+		int getPlayer(int k) const				{ return playerPerm.at(k); }
+		int getRank(int o, int x) const			{ return ranks.at(o * numPlayers + x); }
+		int getStrict2x2Class() const			{ return strict2x2Class; }
+		int getStrict2x2Index() const			{ return strict2x2Index; }
+		bool isStrictOrdinal2x2() const			{ return strictOrdinal2x2; }
+		bool isSymmetric2x2() const				{ return symmetric2x2; }
+
+		bool operator==(const CanonicalForm &c) const	{ return numStrats == c.numStrats && ranks == c.ranks; }
+		bool operator!=(const CanonicalForm &c) const	{ return !(*this == c); }
+		bool operator<(const CanonicalForm &c) const;
+
+		int fromCanonical(int) const;
+		string strict2x2Name() const;
+		int toCanonical(int) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor from a game's features
+template <typename T>
+CanonicalForm::CanonicalForm(const GameFeatures<T> &features)
+{
+	vector<int> nS = vector<int>(features.getNumPlayers());
+	for (int x = 0; x < features.getNumPlayers(); x++)
+		nS.at(x) = features.getNumStrats(x);
+
+	vector<int> r = vector<int>(features.getNumOutcomes() * features.getNumPlayers());
+	for (int o = 0; o < features.getNumOutcomes(); o++)
+		for (int x = 0; x < features.getNumPlayers(); x++)
+			r.at(o * features.getNumPlayers() + x) = features.getRank(x, o);
+
+	*this = CanonicalForm(nS, r);
+}
+
+// constructor from flat ordinal ranks
+CanonicalForm::CanonicalForm(const vector<int> &nS, const vector<int> &r)
+{
+	numPlayers = nS.size();
+	originalNumStrats = nS;
+	originalRanks = r;
+	numOutcomes = 1;
+	for (int x = 0; x < numPlayers; x++)
+		numOutcomes *= nS.at(x);
+
+	// players with fewer strategies first; only players with the same number can be swapped
+	playerPerm = vector<int>(numPlayers);
+	for (int k = 0; k < numPlayers; k++)
+		playerPerm.at(k) = k;
+	stable_sort(playerPerm.begin(), playerPerm.end(), [&nS](int a, int b) { return nS.at(a) < nS.at(b); });
+	numStrats = vector<int>(numPlayers);
+	for (int k = 0; k < numPlayers; k++)
+		numStrats.at(k) = nS.at(playerPerm.at(k));
+
+	ranks.clear();
+	vector<int> bestPlayers = playerPerm;
+	vector<vector<int> > bestStrats;
+	vector<int> perm = vector<int>(numPlayers);
+	for (int k = 0; k < numPlayers; k++)
+		perm.at(k) = k;
+
+	// every ordering of players within groups of equal size
+	do
+	{
+		bool valid = true;
+		for (int k = 0; k < numPlayers; k++)
+		{
+			if (nS.at(perm.at(k)) != numStrats.at(k))
+				valid = false;
+		}
+		if (valid)
+		{
+			vector<vector<int> > strats = vector<vector<int> >(numPlayers);
+			for (int x = 0; x < numPlayers; x++)
+			{
+				strats.at(x) = vector<int>(nS.at(x));
+				for (int s = 0; s < nS.at(x); s++)
+					strats.at(x).at(s) = s;
+			}
+			playerPerm = perm;
+			vector<int> oldBest = ranks;
+			search(0, strats, ranks);
+			if (ranks != oldBest)
+			{
+				bestPlayers = perm;
+				bestStrats = stratPerms;
+			}
+		}
+	} while (next_permutation(perm.begin(), perm.end()));
+
+	playerPerm = bestPlayers;
+	stratPerms = bestStrats;
+	computeHash();
+	compute2x2Taxonomy();
+}
+
+// canonical outcome -> original outcome
+int CanonicalForm::fromCanonical(int c) const
+{
+	vector<int> canonicalProfile = vector<int>(numPlayers);
+	for (int k = 0; k < numPlayers; k++)
+	{
+		canonicalProfile.at(k) = c % numStrats.at(k);
+		c /= numStrats.at(k);
+	}
+
+	int o = 0, stride = 1;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		int k = find(playerPerm.begin(), playerPerm.end(), x) - playerPerm.begin();
+		int s = find(stratPerms.at(x).begin(), stratPerms.at(x).end(), canonicalProfile.at(k)) - stratPerms.at(x).begin();
+		o += s * stride;
+		stride *= originalNumStrats.at(x);
+	}
+	return o;
+}
+
+// 64-bit FNV-1a over the shape and the canonical ranks, stable across runs
+void CanonicalForm::computeHash()
+{
+	hashValue = 14695981039346656037ULL;
+	vector<int> data = numStrats;
+	data.insert(data.begin(), numPlayers);
+	data.insert(data.end(), ranks.begin(), ranks.end());
+	for (int n = 0; (unsigned)n < data.size(); n++)
+	{
+		unsigned int word = data.at(n);
+		for (int b = 0; b < 4; b++)
+		{
+			hashValue ^= (word >> (8 * b)) & 0xff;
+			hashValue *= 1099511628211ULL;
+		}
+	}
+}
+
+/*
+	Strict ordinal 2x2 games (each player ranks the 4 outcomes without ties).
+	Up to relabeling strategies there are 144 of them, and 78 when the players
+	can be swapped as well. These are the games Robinson and Goforth tabulate,
+	but the numbering is gt's own (see index2x2()), not their table's; only the
+	standard dilemmas are named, by strict2x2Name().
+
+	strict2x2Index: 0,...,143, the smallest index over the 4 relabelings
+	strict2x2Class: 0,...,143, the smaller index of the game and its player swap
+	symmetric2x2: u_1(s, t) = u_2(t, s) for some matching of the players' strategies
+*/
+void CanonicalForm::compute2x2Taxonomy()
+{
+	strictOrdinal2x2 = false;
+	strict2x2Index = -1;
+	strict2x2Class = -1;
+	symmetric2x2 = false;
+
+	if (numPlayers != 2 || originalNumStrats.at(0) != 2 || originalNumStrats.at(1) != 2)
+		return;
+	for (int x = 0; x < 2; x++)
+	{
+		vector<int> seen = vector<int>(4, 0);
+		for (int o = 0; o < 4; o++)
+		{
+			int r = originalRanks.at(o * 2 + x);
+			if (r < 0 || r > 3 || seen.at(r))
+				return;
+			seen.at(r) = 1;
+		}
+	}
+	strictOrdinal2x2 = true;
+
+	// player swap: P_1's payoff at (i, j) is P_2's old payoff at (j, i)
+	vector<int> swapped = vector<int>(8);
+	for (int i = 0; i < 2; i++)
+		for (int j = 0; j < 2; j++)
+		{
+			swapped.at((i + 2 * j) * 2) = originalRanks.at((j + 2 * i) * 2 + 1);
+			swapped.at((i + 2 * j) * 2 + 1) = originalRanks.at((j + 2 * i) * 2);
+		}
+
+	strict2x2Index = index2x2(originalRanks);
+	strict2x2Class = min(strict2x2Index, index2x2(swapped));
+	symmetric2x2 = isSymmetricUnder(0) || isSymmetricUnder(1);
+}
+
+/*
+	Smallest index of a strict 2x2 game over its 4 relabelings. With P_1's best
+	outcome moved to the top-left, the index is 24 * (rank of the order of P_1's
+	other 3 ranks among their 6 orders) + (rank of P_2's 4 ranks among their 24
+	orders), both in lexicographic order.
+*/
+int CanonicalForm::index2x2(const vector<int> &r) const
+{
+	int best = -1;
+	for (int flip = 0; flip < 4; flip++)
+	{
+		// P_1's and P_2's ranks after flipping rows (flip & 1) and columns (flip & 2)
+		vector<int> p1 = vector<int>(4), p2 = vector<int>(4);
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+			{
+				int o = (i ^ (flip & 1)) + 2 * (j ^ (flip >> 1));
+				p1.at(i + 2 * j) = r.at(o * 2);
+				p2.at(i + 2 * j) = r.at(o * 2 + 1);
+			}
+
+		// P_1's best outcome must be in the top-left, which picks exactly one relabeling
+		if (p1.at(0) != 3)
+			continue;
+
+		// 6 arrangements of P_1's other ranks times 24 arrangements of P_2's
+		int a = 0, b = 0;
+		vector<int> rest(p1.begin() + 1, p1.end());
+		vector<int> sorted = rest;
+		sort(sorted.begin(), sorted.end());
+		while (sorted != rest)
+		{
+			next_permutation(sorted.begin(), sorted.end());
+			a++;
+		}
+		vector<int> identity = vector<int>(4);
+		for (int n = 0; n < 4; n++)
+			identity.at(n) = n;
+		while (identity != p2)
+		{
+			next_permutation(identity.begin(), identity.end());
+			b++;
+		}
+		int index = 24 * a + b;
+		if (best == -1 || index < best)
+			best = index;
+	}
+	return best;
+}
+
+// identifying P_1's strategy s with P_2's strategy s ^ f, u_1(i, k) = u_2(k, i)
+bool CanonicalForm::isSymmetricUnder(int f) const
+{
+	for (int i = 0; i < 2; i++)
+		for (int k = 0; k < 2; k++)
+		{
+			if (originalRanks.at((i + 2 * (k ^ f)) * 2) != originalRanks.at((k + 2 * (i ^ f)) * 2 + 1))
+				return false;
+		}
+	return true;
+}
+
+// lexicographic order of canonical forms, so they can be map keys
+bool CanonicalForm::operator<(const CanonicalForm &c) const
+{
+	if (numStrats != c.numStrats)
+		return numStrats < c.numStrats;
+	return ranks < c.ranks;
+}
+
+// ranks after relabeling players by playerPerm and strategies by strats
+vector<int> CanonicalForm::relabel(const vector<int> &r, const vector<vector<int> > &strats) const
+{
+	vector<int> result = vector<int>(numOutcomes * numPlayers);
+	vector<int> prof = vector<int>(numPlayers, 0);
+	for (int o = 0; o < numOutcomes; o++)
+	{
+		int c = 0, stride = 1;
+		for (int k = 0; k < numPlayers; k++)
+		{
+			int x = playerPerm.at(k);
+			c += strats.at(x).at(prof.at(x)) * stride;
+			stride *= numStrats.at(k);
+		}
+		for (int k = 0; k < numPlayers; k++)
+			result.at(c * numPlayers + k) = r.at(o * numPlayers + playerPerm.at(k));
+
+		for (int x = 0; x < numPlayers; x++)
+		{
+			prof.at(x)++;
+			if (prof.at(x) < originalNumStrats.at(x))
+				break;
+			prof.at(x) = 0;
+		}
+	}
+	return result;
+}
+
+// try every relabeling of P_x, ..., P_N's strategies, keeping the smallest ranks in best
+void CanonicalForm::search(int x, vector<vector<int> > &strats, vector<int> &best)
+{
+	if (x == numPlayers)
+	{
+		vector<int> candidate = relabel(originalRanks, strats);
+		if (best.empty() || candidate < best)
+		{
+			best = candidate;
+			stratPerms = strats;
+		}
+		return;
+	}
+
+	sort(strats.at(x).begin(), strats.at(x).end());
+	do
+	{
+		search(x + 1, strats, best);
+	} while (next_permutation(strats.at(x).begin(), strats.at(x).end()));
+}
+
+/*
+	Names of the symmetric strict 2x2 games that are standard dilemmas, using
+	R (both cooperate), S (cooperate against defection), T (defect against
+	cooperation) and P (both defect). Empty if the game isn't one of them.
+*/
+string CanonicalForm::strict2x2Name() const
+{
+	if (!strictOrdinal2x2 || !symmetric2x2)
+		return "";
+
+	for (int f = 0; f < 2; f++)
+	{
+		if (!isSymmetricUnder(f))
+			continue;
+
+		for (int c = 0; c < 2; c++) // cooperation is strategy c
+		{
+			int d = 1 - c;
+			int R = originalRanks.at((c + 2 * (c ^ f)) * 2);
+			int S = originalRanks.at((c + 2 * (d ^ f)) * 2);
+			int T = originalRanks.at((d + 2 * (c ^ f)) * 2);
+			int P = originalRanks.at((d + 2 * (d ^ f)) * 2);
+			if (T > R && R > P && P > S)
+				return "Prisoner's Dilemma";
+			if (T > R && R > S && S > P)
+				return "Chicken";
+			if (R > T && T > P && P > S)
+				return "Stag Hunt";
+			if (T > P && P > R && R > S)
+				return "Deadlock";
+		}
+	}
+	return "";
+}
+
+// original outcome -> canonical outcome
+int CanonicalForm::toCanonical(int o) const
+{
+	vector<int> prof = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		prof.at(x) = o % originalNumStrats.at(x);
+		o /= originalNumStrats.at(x);
+	}
+
+	int c = 0, stride = 1;
+	for (int k = 0; k < numPlayers; k++)
+	{
+		int x = playerPerm.at(k);
+		c += stratPerms.at(x).at(prof.at(x)) * stride;
+		stride *= numStrats.at(k);
+	}
+	return c;
+}
+
+#endif
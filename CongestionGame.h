@@ -0,0 +1,327 @@
+/*************************************************
+Title: CongestionGame.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: congestion games and Rosenthal
+		 potential best-response dynamics
+**************************************************/
+
+#ifndef CONGESTIONGAME_H
+#define CONGESTIONGAME_H
+
+#include "SimGame.h"
+
+/*
+	Players choose subsets of resources, and a resource used by k players costs each of
+	them c_r(k). A player's cost is the sum over their resources. Storage is the cost
+	tables plus the strategies, however many profiles there are.
+
+	Rosenthal's potential, the sum over resources of c_r(1) + ... + c_r(load), changes by
+	exactly the mover's change in cost whenever one player switches. So best-response
+	dynamics can't cycle, and every move lowers the potential. The dynamics keep the
+	loads and the potential up to date instead of recomputing them, so a move costs the
+	size of the strategies involved. With integer costs the number of moves is at most
+	the starting potential minus the minimum, which is polynomial in the player count
+	and the largest cost.
+
+	simGame payoffs are maximized, so toSimGame() uses minus the costs.
+*/
+template <typename T>
+class CongestionGame
+{
+	private:
+		int numPlayers;
+		int numResources;
+		vector<vector<T> > costs; // costs.at(r).at(k - 1) = c_r(k)
+		vector<vector<vector<int> > > strategies; // resources in each strategy of each player
+
+		void computeLoads(const vector<int> &, vector<int> &) const;
+		T deviationCost(int, int, const vector<int> &, const vector<bool> &) const;
+	public:
+		CongestionGame(int, int);
+
+		int getNumPlayers() const			{ return numPlayers; }
+		int getNumResources() const			{ return numResources; }
+		int getNumStrats(int x) const		{ return strategies.at(x).size(); }
+		vector<int> getStrategy(int x, int s) const	{ return strategies.at(x).at(s); }
+
+		int addStrategy(int, const vector<int> &);
+		long long computeBestResponseDynamics(vector<int> &, long long, T &) const;
+		T computePotential(const vector<int> &) const;
+		T getCost(const vector<int> &, int) const;
+		bool isPureEquilibrium(const vector<int> &) const;
+		void printEquilibrium() const;
+		void randGame();
+		void setAffineCost(int, T, T);
+		void setCost(int, const vector<T> &);
+		simGame<T>* toSimGame() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, every resource costs 0 and nobody has strategies yet
+template <typename T>
+CongestionGame<T>::CongestionGame(int nP, int nR)
+{
+	numPlayers = nP;
+	numResources = nR;
+	costs = vector<vector<T> >(nR, vector<T>(nP, T(0)));
+	strategies = vector<vector<vector<int> > >(nP);
+}
+
+// gives P_x a strategy using these resources, returns its index or -1
+template <typename T>
+int CongestionGame<T>::addStrategy(int x, const vector<int> &resources)
+{
+	for (int i = 0; (unsigned)i < resources.size(); i++)
+	{
+		if (resources.at(i) < 0 || resources.at(i) >= numResources)
+		{
+			cout << "ERROR: there's no resource " << resources.at(i) + 1 << endl;
+			return -1;
+		}
+		for (int j = 0; j < i; j++)
+		{
+			if (resources.at(j) == resources.at(i))
+			{
+				cout << "ERROR: a strategy can't use resource " << resources.at(i) + 1 << " twice\n";
+				return -1;
+			}
+		}
+	}
+	strategies.at(x).push_back(resources);
+	return strategies.at(x).size() - 1;
+}
+
+/*
+	Starting from profile, lets each player in turn switch to their cheapest strategy
+	(the first one, on ties) if it's strictly cheaper, until a whole pass has no moves.
+	The loads and the potential are updated per move. Returns the number of moves, or -1
+	if maxMoves (-1 for no limit) ran out; profile ends where the dynamics stopped and
+	potential is Rosenthal's potential there.
+*/
+template <typename T>
+long long CongestionGame<T>::computeBestResponseDynamics(vector<int> &profile, long long maxMoves, T &potential) const
+{
+	vector<int> loads;
+	vector<bool> inCurrent = vector<bool>(numResources, false);
+	long long moves = 0;
+	int quiet = 0; // players in a row who didn't move
+
+	computeLoads(profile, loads);
+	potential = computePotential(profile);
+	for (int x = 0; quiet < numPlayers; x = (x + 1) % numPlayers)
+	{
+		const vector<int> &current = strategies.at(x).at(profile.at(x));
+		for (int i = 0; (unsigned)i < current.size(); i++)
+			inCurrent.at(current.at(i)) = true;
+
+		T currentCost = deviationCost(x, profile.at(x), loads, inCurrent);
+		T bestCost = currentCost;
+		int best = profile.at(x);
+		for (int s = 0; (unsigned)s < strategies.at(x).size(); s++)
+		{
+			T cost = deviationCost(x, s, loads, inCurrent);
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				best = s;
+			}
+		}
+		for (int i = 0; (unsigned)i < current.size(); i++)
+			inCurrent.at(current.at(i)) = false;
+
+		if (best == profile.at(x))
+		{
+			quiet++;
+			continue;
+		}
+		if (moves == maxMoves)
+			return -1;
+
+		for (int i = 0; (unsigned)i < current.size(); i++)
+			loads.at(current.at(i))--;
+		profile.at(x) = best;
+		for (int i = 0; (unsigned)i < strategies.at(x).at(best).size(); i++)
+			loads.at(strategies.at(x).at(best).at(i))++;
+		potential += bestCost - currentCost;
+		moves++;
+		quiet = 0;
+	}
+	return moves;
+}
+
+// number of players on each resource
+template <typename T>
+void CongestionGame<T>::computeLoads(const vector<int> &profile, vector<int> &loads) const
+{
+	loads.assign(numResources, 0);
+	for (int x = 0; x < numPlayers; x++)
+		for (int i = 0; (unsigned)i < strategies.at(x).at(profile.at(x)).size(); i++)
+			loads.at(strategies.at(x).at(profile.at(x)).at(i))++;
+}
+
+// Rosenthal's potential
+template <typename T>
+T CongestionGame<T>::computePotential(const vector<int> &profile) const
+{
+	vector<int> loads;
+	T potential = T(0);
+
+	computeLoads(profile, loads);
+	for (int r = 0; r < numResources; r++)
+		for (int k = 0; k < loads.at(r); k++)
+			potential += costs.at(r).at(k);
+	return potential;
+}
+
+/*
+	P_x's cost for strategy s with everyone else staying put: resources P_x is already
+	on (inCurrent) keep their load, and the others get one more
+*/
+template <typename T>
+T CongestionGame<T>::deviationCost(int x, int s, const vector<int> &loads, const vector<bool> &inCurrent) const
+{
+	T cost = T(0);
+	const vector<int> &resources = strategies.at(x).at(s);
+
+	for (int i = 0; (unsigned)i < resources.size(); i++)
+	{
+		int r = resources.at(i);
+		cost += costs.at(r).at(inCurrent.at(r) ? loads.at(r) - 1 : loads.at(r));
+	}
+	return cost;
+}
+
+template <typename T>
+T CongestionGame<T>::getCost(const vector<int> &profile, int x) const
+{
+	vector<int> loads;
+	T cost = T(0);
+
+	computeLoads(profile, loads);
+	for (int i = 0; (unsigned)i < strategies.at(x).at(profile.at(x)).size(); i++)
+	{
+		int r = strategies.at(x).at(profile.at(x)).at(i);
+		cost += costs.at(r).at(loads.at(r) - 1);
+	}
+	return cost;
+}
+
+template <typename T>
+bool CongestionGame<T>::isPureEquilibrium(const vector<int> &profile) const
+{
+	vector<int> loads;
+	vector<bool> inCurrent = vector<bool>(numResources, false);
+
+	computeLoads(profile, loads);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		const vector<int> &current = strategies.at(x).at(profile.at(x));
+		for (int i = 0; (unsigned)i < current.size(); i++)
+			inCurrent.at(current.at(i)) = true;
+
+		bool improves = false;
+		T currentCost = deviationCost(x, profile.at(x), loads, inCurrent);
+		for (int s = 0; (unsigned)s < strategies.at(x).size() && !improves; s++)
+			improves = deviationCost(x, s, loads, inCurrent) < currentCost;
+
+		for (int i = 0; (unsigned)i < current.size(); i++)
+			inCurrent.at(current.at(i)) = false;
+		if (improves)
+			return false;
+	}
+	return true;
+}
+
+/*
+	Pure Equilibrium (12 moves from everyone on s_1, potential 57):
+	P_1: s_2  cost 9
+	...
+*/
+template <typename T>
+void CongestionGame<T>::printEquilibrium() const
+{
+	vector<int> profile = vector<int>(numPlayers, 0);
+	T potential = T(0);
+
+	for (int x = 0; x < numPlayers; x++)
+	{
+		if (strategies.at(x).empty())
+		{
+			cout << "ERROR: P_" << x + 1 << " has no strategies\n";
+			return;
+		}
+	}
+	long long moves = computeBestResponseDynamics(profile, -1, potential);
+
+	cout << "\nPure Equilibrium (" << moves << " moves from everyone on s_1, potential " << potential << "):\n";
+	for (int x = 0; x < numPlayers; x++)
+		cout << "P_" << x + 1 << ": s_" << profile.at(x) + 1 << "  cost " << getCost(profile, x) << endl;
+}
+
+// nondecreasing costs with random steps from 0 to 9
+template <typename T>
+void CongestionGame<T>::randGame()
+{
+	for (int r = 0; r < numResources; r++)
+	{
+		T cost = rand() % 10;
+		for (int k = 0; k < numPlayers; k++)
+		{
+			costs.at(r).at(k) = cost;
+			cost += rand() % 10;
+		}
+	}
+}
+
+// c_r(k) = a * k + b
+template <typename T>
+void CongestionGame<T>::setAffineCost(int r, T a, T b)
+{
+	for (int k = 1; k <= numPlayers; k++)
+		costs.at(r).at(k - 1) = a * k + b;
+}
+
+// c.at(k - 1) is the cost with k players on r, for k from 1 to numPlayers
+template <typename T>
+void CongestionGame<T>::setCost(int r, const vector<T> &c)
+{
+	if ((int)c.size() != numPlayers)
+	{
+		cout << "ERROR: resource " << r + 1 << " needs a cost for every load from 1 to " << numPlayers << endl;
+		return;
+	}
+	costs.at(r) = c;
+}
+
+// the full normal form with payoffs minus the costs, so only for small games
+template <typename T>
+simGame<T>* CongestionGame<T>::toSimGame() const
+{
+	simGame<T>* game = new simGame<T>(numPlayers);
+	vector<int> prof = vector<int>(numPlayers, 0);
+	vector<int> nS = vector<int>(numPlayers);
+
+	for (int x = 0; x < numPlayers; x++)
+		nS.at(x) = strategies.at(x).size();
+	game->setAllNumStrats(nS);
+	while (true)
+	{
+		for (int x = 0; x < numPlayers; x++)
+			game->setPayoff(prof, x, T(0) - getCost(prof, x));
+
+		int x = 0;
+		while (x < numPlayers && prof.at(x) == nS.at(x) - 1)
+		{
+			prof.at(x) = 0;
+			x++;
+		}
+		if (x == numPlayers)
+			break;
+		prof.at(x)++;
+	}
+	return game;
+}
+
+#endif
@@ -0,0 +1,682 @@
+/*************************************************
+Title: EvolutionaryDynamics.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: replicator dynamics, Moran and
+		 Wright-Fisher processes and ESSs on
+		 a simGame's payoffs
+**************************************************/
+
+#ifndef EVOLUTIONARYDYNAMICS_H
+#define EVOLUTIONARYDYNAMICS_H
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include "SimGame.h"
+#include "TaskScheduler.h"
+
+/*
+	A two-player game with the same strategies for both players, played by a population.
+	A is P_1's payoff matrix, so A(i, j) is what s_i earns against s_j; for a symmetric
+	game that's everyone's payoff. The payoffs are copied when the object is made.
+
+	The fitness of every strategy against a population state p is the vector Ap,
+	computed from a flat row-major copy of A. The processes keep Ac for the counts c
+	and update it by one column difference when an individual is replaced, so a Moran
+	step costs O(n) instead of O(n^2). Runs of the finite-population processes are
+	spread over threads, and run r always uses the seed seed + r, so results don't
+	depend on the number of threads.
+*/
+template <typename T>
+class EvolutionaryDynamics
+{
+	private:
+		int numStrats;
+		vector<double> payoffs; // A, row-major
+		bool symmetric;
+
+		double payoff(int i, int j) const	{ return payoffs.at(i * numStrats + j); }
+
+		bool negativeOnCone(const vector<int> &, const vector<int> &) const;
+		int simulate(bool, vector<int>, double, long long, mt19937 &) const;
+		vector<double> simulateBatch(bool, const vector<int> &, double, long long, int, int, unsigned) const;
+		bool solveSupport(const vector<int> &, vector<double> &) const;
+
+		static double determinant(vector<vector<double> >);
+		static bool strictlyCopositive(const vector<vector<double> > &);
+	public:
+		EvolutionaryDynamics(simGame<T>*);
+
+		int getNumStrats() const	{ return numStrats; }
+		bool isSymmetric() const	{ return symmetric; }
+
+		vector<double> computeFitness(const vector<double> &) const;
+		vector<vector<double> > computeFixationProbabilities(int, double) const;
+		vector<vector<double> > findESS() const;
+		bool isESS(const vector<double> &) const;
+		void printAnalysis(int, double) const;
+		vector<double> replicatorContinuous(vector<double>, double, double) const;
+		vector<double> replicatorDiscrete(vector<double>, int) const;
+		vector<double> simulateMoran(const vector<int> &, double, long long, int, int, unsigned) const;
+		vector<double> simulateWrightFisher(const vector<int> &, double, long long, int, int, unsigned) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, game has to have 2 players with the same number of strategies
+template <typename T>
+EvolutionaryDynamics<T>::EvolutionaryDynamics(simGame<T>* game)
+{
+	numStrats = 0;
+	symmetric = false;
+	if (game->getNumPlayers() != 2 || game->getPlayer(0)->getNumStrats() != game->getPlayer(1)->getNumStrats())
+	{
+		cout << "ERROR: evolutionary dynamics need 2 players with the same number of strategies\n";
+		return;
+	}
+
+	GameFeatures<T> features = game->computeFeatures();
+	numStrats = features.getNumStrats(0);
+	payoffs = vector<double>(numStrats * numStrats);
+	symmetric = true;
+	for (int i = 0; i < numStrats; i++)
+		for (int j = 0; j < numStrats; j++)
+		{
+			payoffs.at(i * numStrats + j) = static_cast<double>(features.getPayoff(i + numStrats * j, 0));
+			if (features.getPayoff(i + numStrats * j, 0) != features.getPayoff(j + numStrats * i, 1))
+				symmetric = false;
+		}
+}
+
+// Ap, the expected payoff of each strategy against population state p
+template <typename T>
+vector<double> EvolutionaryDynamics<T>::computeFitness(const vector<double> &p) const
+{
+	vector<double> fitness = vector<double>(numStrats, 0.0);
+	for (int i = 0; i < numStrats; i++)
+	{
+		const double *row = &payoffs.at(i * numStrats);
+		double sum = 0.0;
+		for (int j = 0; j < numStrats; j++)
+			sum += row[j] * p.at(j);
+		fitness.at(i) = sum;
+	}
+	return fitness;
+}
+
+/*
+	Entry (i, j) is the probability that one s_j mutant takes over a population of N - 1
+	s_i's in the Moran process with selection intensity w, where fitness is
+	1 - w + w * payoff and nobody plays themselves (Nowak et al. 2004). The products in
+	the closed form are summed in log space so large N doesn't overflow. The diagonal is
+	the neutral 1 / N.
+*/
+template <typename T>
+vector<vector<double> > EvolutionaryDynamics<T>::computeFixationProbabilities(int N, double w) const
+{
+	vector<vector<double> > rho = vector<vector<double> >(numStrats, vector<double>(numStrats, 1.0 / N));
+
+	for (int i = 0; i < numStrats; i++)
+		for (int j = 0; j < numStrats; j++)
+		{
+			if (i == j)
+				continue;
+
+			// 1 / rho = sum over k < N of prod over m <= k of (resident fitness / mutant fitness) with m mutants
+			double logProduct = 0.0;
+			double maxLog = 0.0; // the k = 0 term is 1
+			vector<double> logTerms = vector<double>(1, 0.0);
+			for (int m = 1; m < N; m++)
+			{
+				double mutant = 1.0 - w + w * (payoff(j, j) * (m - 1) + payoff(j, i) * (N - m)) / (N - 1);
+				double resident = 1.0 - w + w * (payoff(i, j) * m + payoff(i, i) * (N - m - 1)) / (N - 1);
+				if (mutant <= 0.0 || resident <= 0.0)
+				{
+					cout << "ERROR: w = " << w << " makes some fitness nonpositive\n";
+					return vector<vector<double> >();
+				}
+				logProduct += log(resident) - log(mutant);
+				logTerms.push_back(logProduct);
+				if (logProduct > maxLog)
+					maxLog = logProduct;
+			}
+
+			double sum = 0.0;
+			for (int k = 0; (unsigned)k < logTerms.size(); k++)
+				sum += exp(logTerms.at(k) - maxLog);
+			rho.at(i).at(j) = exp(-maxLog) / sum;
+		}
+	return rho;
+}
+
+// Gaussian elimination with partial pivoting
+template <typename T>
+double EvolutionaryDynamics<T>::determinant(vector<vector<double> > M)
+{
+	int n = M.size();
+	double det = 1.0;
+
+	for (int c = 0; c < n; c++)
+	{
+		int best = c;
+		for (int r = c + 1; r < n; r++)
+		{
+			if (fabs(M.at(r).at(c)) > fabs(M.at(best).at(c)))
+				best = r;
+		}
+		if (M.at(best).at(c) == 0.0)
+			return 0.0;
+		if (best != c)
+		{
+			swap(M.at(c), M.at(best));
+			det = -det;
+		}
+		det *= M.at(c).at(c);
+		for (int r = c + 1; r < n; r++)
+		{
+			double factor = M.at(r).at(c) / M.at(c).at(c);
+			for (int l = c; l < n; l++)
+				M.at(r).at(l) -= factor * M.at(c).at(l);
+		}
+	}
+	return det;
+}
+
+/*
+	Every ESS, found by support enumeration: each support's candidate equilibrium solves
+	A_S p = v 1, sum p = 1, and is checked with isESS(). Only practical for small games.
+*/
+template <typename T>
+vector<vector<double> > EvolutionaryDynamics<T>::findESS() const
+{
+	vector<vector<double> > ess;
+
+	if (numStrats > 20)
+	{
+		cout << "ERROR: too many strategies for support enumeration\n";
+		return ess;
+	}
+	for (long long mask = 1; mask < (1LL << numStrats); mask++)
+	{
+		vector<int> support;
+		for (int i = 0; i < numStrats; i++)
+		{
+			if (mask & (1LL << i))
+				support.push_back(i);
+		}
+
+		vector<double> p;
+		if (solveSupport(support, p) && isESS(p))
+			ess.push_back(p);
+	}
+	return ess;
+}
+
+/*
+	p is an ESS if it's a symmetric equilibrium and z^T A z < 0 for every nonzero z that
+	moves from p toward its best replies (Haigh): z sums to 0, lives on the best
+	replies, and can't be negative on a best reply p doesn't play.
+*/
+template <typename T>
+bool EvolutionaryDynamics<T>::isESS(const vector<double> &p) const
+{
+	const double eps = 1e-9;
+	vector<double> fitness = computeFitness(p);
+	vector<int> support, ties;
+	double average = 0.0;
+
+	for (int i = 0; i < numStrats; i++)
+		average += p.at(i) * fitness.at(i);
+	for (int i = 0; i < numStrats; i++)
+	{
+		if (fitness.at(i) > average + eps)
+			return false; // not an equilibrium
+		if (p.at(i) > eps)
+			support.push_back(i);
+		else if (fitness.at(i) >= average - eps)
+			ties.push_back(i);
+	}
+	return negativeOnCone(support, ties);
+}
+
+/*
+	Whether z^T A z < 0 for every nonzero z = sum a_k (e_k - e_s) + sum b_t (e_t - e_s) with
+	k in support, t in ties, s = support.at(0) and every b_t >= 0. In those coordinates
+	the form is -M for a symmetric M; eliminating the free a's needs their block to be
+	positive definite and leaves the Schur complement, which has to be strictly
+	copositive in the b's.
+*/
+template <typename T>
+bool EvolutionaryDynamics<T>::negativeOnCone(const vector<int> &support, const vector<int> &ties) const
+{
+	int s = support.at(0);
+	int numFree = support.size() - 1;
+	int d = numFree + ties.size();
+	vector<vector<double> > M = vector<vector<double> >(d, vector<double>(d));
+
+	for (int k = 0; k < d; k++)
+		for (int l = 0; l < d; l++)
+		{
+			int a = (k < numFree) ? support.at(k + 1) : ties.at(k - numFree);
+			int b = (l < numFree) ? support.at(l + 1) : ties.at(l - numFree);
+			double zAz = payoff(a, b) - payoff(a, s) - payoff(s, b) + payoff(s, s);
+			double zATz = payoff(b, a) - payoff(s, a) - payoff(b, s) + payoff(s, s);
+			M.at(k).at(l) = -(zAz + zATz) / 2.0;
+		}
+
+	// symmetric elimination without pivoting, which only succeeds on a positive definite block
+	for (int k = 0; k < numFree; k++)
+	{
+		if (M.at(k).at(k) <= 1e-9)
+			return false;
+		for (int r = k + 1; r < d; r++)
+		{
+			double factor = M.at(r).at(k) / M.at(k).at(k);
+			for (int l = k; l < d; l++)
+				M.at(r).at(l) -= factor * M.at(k).at(l);
+		}
+	}
+
+	vector<vector<double> > C = vector<vector<double> >(d - numFree, vector<double>(d - numFree));
+	for (int k = 0; k < d - numFree; k++)
+		for (int l = 0; l < d - numFree; l++)
+			C.at(k).at(l) = (M.at(numFree + k).at(numFree + l) + M.at(numFree + l).at(numFree + k)) / 2.0;
+	return strictlyCopositive(C);
+}
+
+/*
+	Symmetric game:  yes
+	ESS:  (s_1)
+	Fixation probabilities (N = 100, w = 0.1), mutant by row, resident by column:
+	...
+*/
+template <typename T>
+void EvolutionaryDynamics<T>::printAnalysis(int N, double w) const
+{
+	if (numStrats == 0)
+		return;
+
+	vector<vector<double> > ess = findESS();
+	vector<vector<double> > rho = computeFixationProbabilities(N, w);
+
+	cout << "\nEVOLUTIONARY ANALYSIS:\n";
+	cout << "--------------------------\n";
+	cout << "Symmetric game:  " << (symmetric ? "yes" : "no (using P_1's payoffs)") << endl;
+	cout << "ESS:  ";
+	if (ess.empty())
+		cout << "none";
+	for (int e = 0; (unsigned)e < ess.size(); e++)
+	{
+		bool first = true;
+		cout << "(";
+		for (int i = 0; i < numStrats; i++)
+		{
+			if (ess.at(e).at(i) <= 1e-9)
+				continue;
+			if (!first)
+				cout << ", ";
+			if (ess.at(e).at(i) < 1.0 - 1e-9)
+				cout << ess.at(e).at(i) << " ";
+			cout << "s_" << i + 1;
+			first = false;
+		}
+		cout << ")";
+		if ((unsigned)e < ess.size() - 1)
+			cout << ", ";
+	}
+	cout << endl;
+
+	if (rho.empty())
+		return;
+	cout << "\nFixation probabilities (N = " << N << ", w = " << w << ", neutral " << 1.0 / N << "), mutant by row, resident by column:\n";
+	cout << "     ";
+	for (int i = 0; i < numStrats; i++)
+		cout << setw(12) << "s_" + to_string(i + 1);
+	cout << endl;
+	for (int j = 0; j < numStrats; j++)
+	{
+		cout << left << setw(5) << "s_" + to_string(j + 1) << right;
+		for (int i = 0; i < numStrats; i++)
+		{
+			if (i == j)
+				cout << setw(12) << "-";
+			else
+				cout << setw(12) << rho.at(i).at(j);
+		}
+		cout << endl;
+	}
+}
+
+// integrates p_i' = p_i ((Ap)_i - p^T A p) from 0 to time with RK4 steps of size dt
+template <typename T>
+vector<double> EvolutionaryDynamics<T>::replicatorContinuous(vector<double> p, double time, double dt) const
+{
+	vector<vector<double> > k = vector<vector<double> >(4, vector<double>(numStrats));
+	vector<double> q = vector<double>(numStrats);
+	const double weights[4] = {1.0, 2.0, 2.0, 1.0};
+
+	for (double t = 0.0; t < time - 1e-12; t += dt)
+	{
+		double h = min(dt, time - t);
+		for (int stage = 0; stage < 4; stage++)
+		{
+			double offset = (stage == 0) ? 0.0 : (stage == 3 ? h : h / 2.0);
+			for (int i = 0; i < numStrats; i++)
+				q.at(i) = p.at(i) + (stage == 0 ? 0.0 : offset * k.at(stage - 1).at(i));
+
+			vector<double> fitness = computeFitness(q);
+			double average = 0.0;
+			for (int i = 0; i < numStrats; i++)
+				average += q.at(i) * fitness.at(i);
+			for (int i = 0; i < numStrats; i++)
+				k.at(stage).at(i) = q.at(i) * (fitness.at(i) - average);
+		}
+
+		double total = 0.0;
+		for (int i = 0; i < numStrats; i++)
+		{
+			for (int stage = 0; stage < 4; stage++)
+				p.at(i) += h * weights[stage] * k.at(stage).at(i) / 6.0;
+			if (p.at(i) < 0.0)
+				p.at(i) = 0.0;
+			total += p.at(i);
+		}
+		for (int i = 0; i < numStrats; i++)
+			p.at(i) /= total;
+	}
+	return p;
+}
+
+/*
+	p_i <- p_i ((Ap)_i + c) / (p^T A p + c) for the given number of generations, where
+	the background fitness c makes every payoff positive
+*/
+template <typename T>
+vector<double> EvolutionaryDynamics<T>::replicatorDiscrete(vector<double> p, int steps) const
+{
+	double minPayoff = payoffs.at(0);
+	for (int o = 1; (unsigned)o < payoffs.size(); o++)
+	{
+		if (payoffs.at(o) < minPayoff)
+			minPayoff = payoffs.at(o);
+	}
+	double background = (minPayoff > 0.0) ? 0.0 : 1.0 - minPayoff;
+
+	for (int s = 0; s < steps; s++)
+	{
+		vector<double> fitness = computeFitness(p);
+		double average = 0.0;
+		for (int i = 0; i < numStrats; i++)
+			average += p.at(i) * fitness.at(i);
+		for (int i = 0; i < numStrats; i++)
+			p.at(i) *= (fitness.at(i) + background) / (average + background);
+	}
+	return p;
+}
+
+/*
+	One run from the given counts until a strategy takes over, returning it, or -1 after
+	maxSteps steps (Moran births or Wright-Fisher generations). fitness is
+	1 - w + w * payoff, where payoff is the average over the rest of the population.
+*/
+template <typename T>
+int EvolutionaryDynamics<T>::simulate(bool wrightFisher, vector<int> counts, double w, long long maxSteps, mt19937 &generator) const
+{
+	int N = 0;
+	vector<double> totals = vector<double>(numStrats, 0.0); // A counts
+	vector<double> weights = vector<double>(numStrats);
+	uniform_real_distribution<double> uniform(0.0, 1.0);
+
+	for (int i = 0; i < numStrats; i++)
+		N += counts.at(i);
+	for (int i = 0; i < numStrats; i++)
+		for (int j = 0; j < numStrats; j++)
+			totals.at(i) += payoff(i, j) * counts.at(j);
+
+	for (long long step = 0; step < maxSteps; step++)
+	{
+		double sum = 0.0;
+		for (int i = 0; i < numStrats; i++)
+		{
+			if (counts.at(i) == N)
+				return i;
+			double fitness = 1.0 - w + w * (totals.at(i) - payoff(i, i)) / (N - 1);
+			weights.at(i) = (counts.at(i) > 0 && fitness > 0.0) ? counts.at(i) * fitness : 0.0;
+			sum += weights.at(i);
+		}
+		if (sum <= 0.0)
+		{
+			for (int i = 0; i < numStrats; i++)
+				weights.at(i) = counts.at(i);
+			sum = N;
+		}
+
+		if (wrightFisher)
+		{
+			// multinomial by successive binomials, then A counts from scratch
+			int remaining = N;
+			for (int i = 0; i < numStrats; i++)
+			{
+				int drawn = 0;
+				if (remaining > 0 && weights.at(i) > 0.0)
+					drawn = (sum - weights.at(i) <= 0.0) ? remaining : binomial_distribution<int>(remaining, min(1.0, weights.at(i) / sum))(generator);
+				sum -= weights.at(i);
+				counts.at(i) = drawn;
+				remaining -= drawn;
+			}
+			for (int i = 0; i < numStrats; i++)
+			{
+				totals.at(i) = 0.0;
+				for (int j = 0; j < numStrats; j++)
+					totals.at(i) += payoff(i, j) * counts.at(j);
+			}
+		}
+		else
+		{
+			// birth proportional to fitness, death uniform
+			double r = uniform(generator) * sum;
+			int birth = 0;
+			while (birth < numStrats - 1 && (r >= weights.at(birth) || weights.at(birth) == 0.0))
+			{
+				r -= weights.at(birth);
+				birth++;
+			}
+			int d = uniform_int_distribution<int>(0, N - 1)(generator);
+			int death = 0;
+			while (d >= counts.at(death))
+			{
+				d -= counts.at(death);
+				death++;
+			}
+			if (birth != death)
+			{
+				counts.at(birth)++;
+				counts.at(death)--;
+				for (int i = 0; i < numStrats; i++)
+					totals.at(i) += payoff(i, birth) - payoff(i, death);
+			}
+		}
+	}
+	for (int i = 0; i < numStrats; i++)
+	{
+		if (counts.at(i) == N)
+			return i;
+	}
+	return -1;
+}
+
+/*
+	Fraction of numRuns runs won by each strategy, then the fraction that hadn't fixed
+	after maxSteps, with the runs spread over numThreads threads (0 for all of them)
+*/
+template <typename T>
+vector<double> EvolutionaryDynamics<T>::simulateBatch(bool wrightFisher, const vector<int> &counts, double w, long long maxSteps,
+													  int numRuns, int numThreads, unsigned seed) const
+{
+	int N = 0;
+	vector<int> winners = vector<int>(numRuns, -1);
+	vector<double> fractions = vector<double>(numStrats + 1, 0.0);
+
+	for (int i = 0; (unsigned)i < counts.size(); i++)
+		N += counts.at(i);
+	if ((int)counts.size() != numStrats || N < 2 || numRuns < 1)
+	{
+		cout << "ERROR: the population needs a count for each of the " << numStrats << " strategies and at least 2 individuals\n";
+		return vector<double>();
+	}
+
+	TaskScheduler scheduler(numThreads);
+	int chunk = (numRuns + 4 * scheduler.getNumThreads() - 1) / (4 * scheduler.getNumThreads());
+	scheduler.run([&](int w0)
+	{
+		for (int first = 0; first < numRuns; first += chunk)
+			scheduler.spawn(w0, [&, first](int)
+			{
+				for (int r = first; r < numRuns && r < first + chunk; r++)
+				{
+					mt19937 generator(seed + r);
+					winners.at(r) = simulate(wrightFisher, counts, w, maxSteps, generator);
+				}
+			});
+	});
+
+	for (int r = 0; r < numRuns; r++)
+		fractions.at(winners.at(r) == -1 ? numStrats : winners.at(r)) += 1.0 / numRuns;
+	return fractions;
+}
+
+template <typename T>
+vector<double> EvolutionaryDynamics<T>::simulateMoran(const vector<int> &counts, double w, long long maxSteps,
+													  int numRuns, int numThreads, unsigned seed) const
+{
+	return simulateBatch(false, counts, w, maxSteps, numRuns, numThreads, seed);
+}
+
+template <typename T>
+vector<double> EvolutionaryDynamics<T>::simulateWrightFisher(const vector<int> &counts, double w, long long maxSteps,
+															 int numRuns, int numThreads, unsigned seed) const
+{
+	return simulateBatch(true, counts, w, maxSteps, numRuns, numThreads, seed);
+}
+
+// symmetric equilibrium with exactly this support, if A_S p = v 1 and sum p = 1 has a positive solution
+template <typename T>
+bool EvolutionaryDynamics<T>::solveSupport(const vector<int> &support, vector<double> &p) const
+{
+	int k = support.size();
+	vector<vector<double> > M = vector<vector<double> >(k + 1, vector<double>(k + 2, 0.0)); // [A_S -1 | 0; 1 0 | 1]
+
+	for (int r = 0; r < k; r++)
+	{
+		for (int c = 0; c < k; c++)
+			M.at(r).at(c) = payoff(support.at(r), support.at(c));
+		M.at(r).at(k) = -1.0;
+	}
+	for (int c = 0; c < k; c++)
+		M.at(k).at(c) = 1.0;
+	M.at(k).at(k + 1) = 1.0;
+
+	// Gaussian elimination with partial pivoting
+	for (int c = 0; c <= k; c++)
+	{
+		int best = c;
+		for (int r = c + 1; r <= k; r++)
+		{
+			if (fabs(M.at(r).at(c)) > fabs(M.at(best).at(c)))
+				best = r;
+		}
+		if (fabs(M.at(best).at(c)) < 1e-12)
+			return false; // singular, so no isolated equilibrium on this support
+		swap(M.at(c), M.at(best));
+		for (int r = 0; r <= k; r++)
+		{
+			if (r == c)
+				continue;
+			double factor = M.at(r).at(c) / M.at(c).at(c);
+			for (int l = c; l <= k + 1; l++)
+				M.at(r).at(l) -= factor * M.at(c).at(l);
+		}
+	}
+
+	p = vector<double>(numStrats, 0.0);
+	for (int r = 0; r < k; r++)
+	{
+		p.at(support.at(r)) = M.at(r).at(k + 1) / M.at(r).at(r);
+		if (p.at(support.at(r)) <= 1e-12)
+			return false;
+	}
+	return true;
+}
+
+/*
+	x^T C x > 0 for every nonzero x >= 0. Principal submatrices are checked from the
+	smallest up; once all of a submatrix's smaller ones pass, it fails exactly when its
+	determinant is <= 0 and its adjugate is >= 0 (Cottle, Habetler and Lemke).
+*/
+template <typename T>
+bool EvolutionaryDynamics<T>::strictlyCopositive(const vector<vector<double> > &C)
+{
+	const double eps = 1e-9;
+	int n = C.size();
+	vector<long long> masks;
+
+	if (n > 20)
+	{
+		cout << "ERROR: too many tied best replies to check copositivity\n";
+		return false;
+	}
+	for (long long mask = 1; mask < (1LL << n); mask++)
+		masks.push_back(mask);
+	stable_sort(masks.begin(), masks.end(), [](long long a, long long b) { return __builtin_popcountll(a) < __builtin_popcountll(b); });
+
+	for (int m = 0; (unsigned)m < masks.size(); m++)
+	{
+		vector<int> rows;
+		for (int i = 0; i < n; i++)
+		{
+			if (masks.at(m) & (1LL << i))
+				rows.push_back(i);
+		}
+		int size = rows.size();
+		vector<vector<double> > sub = vector<vector<double> >(size, vector<double>(size));
+		for (int i = 0; i < size; i++)
+			for (int j = 0; j < size; j++)
+				sub.at(i).at(j) = C.at(rows.at(i)).at(rows.at(j));
+
+		if (size == 1)
+		{
+			if (sub.at(0).at(0) <= eps)
+				return false;
+			continue;
+		}
+		if (determinant(sub) > eps)
+			continue;
+
+		bool adjugateNonnegative = true;
+		for (int i = 0; i < size && adjugateNonnegative; i++)
+			for (int j = 0; j < size && adjugateNonnegative; j++)
+			{
+				vector<vector<double> > minor;
+				for (int r = 0; r < size; r++)
+				{
+					if (r == j)
+						continue;
+					minor.push_back(vector<double>());
+					for (int c = 0; c < size; c++)
+					{
+						if (c != i)
+							minor.back().push_back(sub.at(r).at(c));
+					}
+				}
+				if (((i + j) % 2 == 0 ? 1.0 : -1.0) * determinant(minor) < -eps)
+					adjugateNonnegative = false;
+			}
+		if (adjugateNonnegative)
+			return false;
+	}
+	return true;
+}
+
+#endif
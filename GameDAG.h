@@ -0,0 +1,355 @@
+/*************************************************
+Title: GameDAG.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: sequential games as hash-consed DAGs with
+		 a transposition table of subgame values
+**************************************************/
+
+#ifndef GAMEDAG_H
+#define GAMEDAG_H
+
+#include <unordered_map>
+#include "SeqGame.h"
+
+/*
+	Game tree in which structurally identical subtrees are stored once. makeLeaf() and
+	makeNode() look a node up by its contents before creating it, so building a game
+	whose subgames repeat (repeated bargaining, alternating offers, ...) bottom-up with
+	them gives a DAG whose size is the number of distinct subgames rather than the
+	number of paths. A node's branches are created before it, so ids are in
+	topological order.
+
+	The subgame-perfect values and choices form a transposition table indexed by id.
+	solve() evaluates each distinct subgame once, in id order, and only the nodes added
+	since the last call, so a subgame shared by many paths is never solved twice.
+*/
+class GameDAG
+{
+	private:
+		struct DAGNode
+		{
+			int player; // who moves here, -1 at leaves
+			int first; // start of the branches in branchPool, or of the payoffs in payoffPool at leaves
+			int num; // number of branches, 0 at leaves
+		};
+
+		int numPlayers;
+		vector<DAGNode> nodes;
+		vector<int> branchPool; // branch ids, -1 for an absent branch
+		vector<int> payoffPool; // numPlayers payoffs per leaf
+		vector<long long> treeSizes; // nodes in the expanded subtree, capped at 2^62
+		unordered_multimap<unsigned long long, int> table; // content hash -> ids
+		vector<int> values; // transposition table, numPlayers values per node
+		vector<int> choices; // -1 at leaves
+		int numSolved; // nodes below this id are in the transposition table
+
+		int find(unsigned long long, int, const vector<int> &) const;
+		unsigned long long hashContents(int, const vector<int> &) const;
+		int makeEntry(unsigned long long, int, const vector<int> &);
+	public:
+		GameDAG(int nP)
+		{
+			numPlayers = nP;
+			numSolved = 0;
+		}
+
+		int getBranch(int n, int s) const
+		{ return branchPool.at(nodes.at(n).first + s); }
+
+		int getNodePlayer(int n) const
+		{ return nodes.at(n).player; }
+
+		int getNumBranches(int n) const
+		{ return nodes.at(n).num; }
+
+		// distinct subgames stored
+		int getNumNodes() const
+		{ return nodes.size(); }
+
+		int getNumPlayers() const
+		{ return numPlayers; }
+
+		long long getTreeSize(int n) const
+		{ return treeSizes.at(n); }
+
+		bool isLeaf(int n) const
+		{ return nodes.at(n).player == -1; }
+
+		int addTree(const SeqGame &, int);
+		int getChoice(int);
+		vector<int> getEquilibriumPath(int);
+		vector<int> getPayoffs(int) const;
+		int getValue(int, int);
+		vector<int> getValues(int);
+		int makeLeaf(const vector<int> &);
+		int makeNode(int, const vector<int> &);
+		void printSubgamePerfect(int);
+		void solve();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+	Adds the subtree of game at node, sharing every subtree that is already in the DAG,
+	and returns its id. Nodes without any branches become leaves with their payoffs.
+*/
+int GameDAG::addTree(const SeqGame &game, int node)
+{
+	vector<pair<int, bool> > stack; // (node, branches done)
+	vector<int> ids; // ids of finished subtrees, in postorder
+
+	if (node == -1)
+		return -1;
+
+	stack.push_back(make_pair(node, false));
+	while (!stack.empty())
+	{
+		int n = stack.back().first;
+		bool expanded = stack.back().second;
+		int numBranches = game.getNode(n).getNumChildren();
+		stack.pop_back();
+
+		if (!expanded)
+		{
+			stack.push_back(make_pair(n, true));
+			for (int s = numBranches - 1; s >= 0; s--)
+			{
+				if (game.getNext(n, s) != -1)
+					stack.push_back(make_pair(game.getNext(n, s), false));
+			}
+			continue;
+		}
+
+		// the present branches' ids are the last ones on ids, in order
+		vector<int> branches = vector<int>(numBranches, -1);
+		int numPresent = 0;
+		for (int s = 0; s < numBranches; s++)
+		{
+			if (game.getNext(n, s) != -1)
+				numPresent++;
+		}
+		int start = ids.size() - numPresent;
+		for (int s = 0, b = start; s < numBranches; s++)
+		{
+			if (game.getNext(n, s) != -1)
+				branches.at(s) = ids.at(b++);
+		}
+		ids.resize(start);
+
+		if (numPresent == 0)
+			ids.push_back(makeLeaf(game.getPayoffs(n)));
+		else
+			ids.push_back(makeNode(game.getNode(n).getNodePlayer(), branches));
+	}
+	return ids.back();
+}
+
+// id with these contents, -1 if there isn't one
+int GameDAG::find(unsigned long long hash, int player, const vector<int> &contents) const
+{
+	pair<unordered_multimap<unsigned long long, int>::const_iterator, unordered_multimap<unsigned long long, int>::const_iterator> range = table.equal_range(hash);
+	for (unordered_multimap<unsigned long long, int>::const_iterator it = range.first; it != range.second; it++)
+	{
+		const DAGNode &node = nodes.at(it->second);
+		const vector<int> &pool = (player == -1) ? payoffPool : branchPool;
+		int num = (player == -1) ? numPlayers : node.num;
+		if (node.player != player || (unsigned)num != contents.size())
+			continue;
+
+		bool same = true;
+		for (int i = 0; i < num && same; i++)
+			same = (pool.at(node.first + i) == contents.at(i));
+		if (same)
+			return it->second;
+	}
+	return -1;
+}
+
+// SPE choice at node n
+int GameDAG::getChoice(int n)
+{
+	solve();
+	return choices.at(n);
+}
+
+// strategies played from root to the subgame-perfect outcome
+vector<int> GameDAG::getEquilibriumPath(int root)
+{
+	vector<int> path;
+
+	solve();
+	int n = root;
+	while (n != -1 && choices.at(n) != -1)
+	{
+		path.push_back(choices.at(n));
+		n = getBranch(n, choices.at(n));
+	}
+	return path;
+}
+
+// payoffs of a leaf
+vector<int> GameDAG::getPayoffs(int n) const
+{
+	return vector<int>(payoffPool.begin() + nodes.at(n).first, payoffPool.begin() + nodes.at(n).first + numPlayers);
+}
+
+int GameDAG::getValue(int n, int x)
+{
+	solve();
+	return values.at(n * numPlayers + x);
+}
+
+vector<int> GameDAG::getValues(int n)
+{
+	solve();
+	return vector<int>(values.begin() + n * numPlayers, values.begin() + (n + 1) * numPlayers);
+}
+
+// FNV-1a of the player and the branch ids or payoffs
+unsigned long long GameDAG::hashContents(int player, const vector<int> &contents) const
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	for (int i = -1; i < (int)contents.size(); i++)
+	{
+		unsigned int word = (i == -1) ? player : contents.at(i);
+		for (int b = 0; b < 4; b++)
+		{
+			hash ^= (word >> (8 * b)) & 0xff;
+			hash *= 1099511628211ULL;
+		}
+	}
+	return hash;
+}
+
+// creates a node with these contents; the caller has checked it's new
+int GameDAG::makeEntry(unsigned long long hash, int player, const vector<int> &contents)
+{
+	const long long cap = 1LL << 62;
+	DAGNode node;
+	long long size = 1;
+
+	node.player = player;
+	if (player == -1)
+	{
+		node.first = payoffPool.size();
+		node.num = 0;
+		payoffPool.insert(payoffPool.end(), contents.begin(), contents.end());
+	}
+	else
+	{
+		node.first = branchPool.size();
+		node.num = contents.size();
+		branchPool.insert(branchPool.end(), contents.begin(), contents.end());
+		for (int s = 0; (unsigned)s < contents.size(); s++)
+		{
+			if (contents.at(s) != -1)
+				size = (size > cap - treeSizes.at(contents.at(s))) ? cap : size + treeSizes.at(contents.at(s));
+		}
+	}
+
+	nodes.push_back(node);
+	treeSizes.push_back(size);
+	table.insert(make_pair(hash, (int)nodes.size() - 1));
+	return nodes.size() - 1;
+}
+
+// id of the leaf with these payoffs, created if it's new
+int GameDAG::makeLeaf(const vector<int> &payoffs)
+{
+	vector<int> contents = payoffs;
+	contents.resize(numPlayers, 0);
+
+	unsigned long long hash = hashContents(-1, contents);
+	int n = find(hash, -1, contents);
+	return (n != -1) ? n : makeEntry(hash, -1, contents);
+}
+
+/*
+	Id of the node where player moves and branch s leads to branches.at(s), created if
+	it's new. Absent branches are -1; every other branch must already be in the DAG.
+*/
+int GameDAG::makeNode(int player, const vector<int> &branches)
+{
+	for (int s = 0; (unsigned)s < branches.size(); s++)
+	{
+		if (branches.at(s) < -1 || branches.at(s) >= (int)nodes.size())
+		{
+			cout << "ERROR: branch " << branches.at(s) << " is not in the DAG\n";
+			return -1;
+		}
+	}
+
+	unsigned long long hash = hashContents(player, branches);
+	int n = find(hash, player, branches);
+	return (n != -1) ? n : makeEntry(hash, player, branches);
+}
+
+// equilibrium path and outcome of the game at root, and how much sharing saved
+void GameDAG::printSubgamePerfect(int root)
+{
+	if (root == -1)
+	{
+		cout << "The tree is empty.\n";
+		return;
+	}
+
+	vector<int> path = getEquilibriumPath(root);
+	cout << "\nSUBGAME-PERFECT EQUILIBRIUM:\n";
+	cout << "--------------------------\n";
+	cout << "Distinct subgames: " << nodes.size() << " (" << treeSizes.at(root) << " nodes in the tree)\n";
+	cout << "Equilibrium path: (";
+	for (int n = 0; (unsigned)n < path.size(); n++)
+	{
+		cout << "s_" << path.at(n) + 1;
+		if ((unsigned)n < path.size() - 1)
+			cout << ", ";
+	}
+	cout << ")\nOutcome: (";
+	for (int x = 0; x < numPlayers; x++)
+	{
+		cout << values.at(root * numPlayers + x);
+		if (x < numPlayers - 1)
+			cout << ", ";
+	}
+	cout << ")\n";
+}
+
+/*
+	Backward induction over the nodes added since the last call. Branches have lower
+	ids than their nodes, so one forward sweep finds each node's branches already
+	solved. Ties go to the lowest strategy, as in SeqGame.
+*/
+void GameDAG::solve()
+{
+	values.resize(nodes.size() * numPlayers, 0);
+	choices.resize(nodes.size(), -1);
+	for (int n = numSolved; (unsigned)n < nodes.size(); n++)
+	{
+		const DAGNode &node = nodes.at(n);
+		if (node.player == -1)
+		{
+			for (int y = 0; y < numPlayers; y++)
+				values.at(n * numPlayers + y) = payoffPool.at(node.first + y);
+			continue;
+		}
+
+		int best = -1;
+		for (int s = 0; s < node.num; s++)
+		{
+			int c = branchPool.at(node.first + s);
+			if (c != -1 && (best == -1
+				|| values.at(c * numPlayers + node.player) > values.at(branchPool.at(node.first + best) * numPlayers + node.player)))
+				best = s;
+		}
+		choices.at(n) = best;
+		if (best != -1)
+		{
+			for (int y = 0; y < numPlayers; y++)
+				values.at(n * numPlayers + y) = values.at(branchPool.at(node.first + best) * numPlayers + y);
+		}
+	}
+	numSolved = nodes.size();
+}
+
+#endif
@@ -0,0 +1,645 @@
+/*****************************************************
+Title: GameFeatures.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: single-pass feature vector for classifying
+		 simultaneous games (replaces check*Conditions)
+******************************************************/
+
+#ifndef GAMEFEATURES_H
+#define GAMEFEATURES_H
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+/*
+	Payoffs are stored flat with P_1's strategy varying fastest:
+		outcome o = s_1 + n_1 * s_2 + n_1 * n_2 * s_3 + ...
+		payoffs.at(o * numPlayers + x) is P_x's payoff at o
+	so P_1/P_2 slices line up with payoffMatrix.at(m).at(i).at(j) for o = i + n_1 * j + n_1 * n_2 * m.
+
+	Everything is computed once in the constructor; the type predicates only
+	read the stored features, so classifying a game costs one pass over the
+	payoffs plus one pass over the flat best-response slices, plus a sort of the
+	outcomes for Pareto optimality (see computePO()).
+*/
+template <typename T>
+class GameFeatures
+{
+	private:
+		int numPlayers;
+		int numOutcomes;
+		vector<int> numStrats;
+		vector<int> strides; // strides.at(x) = n_1 * ... * n_{x - 1}
+		vector<T> payoffs;
+
+		// ordinal rankings, ranks.at(x).at(o) is the rank of o for P_x (0 is the worst)
+		vector<vector<int> > ranks;
+
+		// payoff structure
+		bool constantSum;
+		bool constantPayoffs; // every player gets the same payoff at every outcome
+		vector<bool> po; // po.at(o): outcome o is Pareto-optimal
+		bool allPO;
+
+		// best-response structure
+		vector<vector<bool> > brEverywhere; // brEverywhere.at(x).at(s): s is a BR for P_x against every profile
+		vector<bool> uniqueBRs; // each of P_x's slices has exactly one BR
+
+		// equilibrium structure
+		vector<int> equilibria; // outcome indices
+		vector<bool> paretoEquilibria;
+		int numParetoEquilibria;
+		bool coordination; // all equilibria on the diagonal
+		bool equalEquilibria; // all equilibria have the same payoffs
+		bool distinctDiagonal; // no two diagonal outcomes have the same payoffs for P_1 and P_2
+		bool bosRelation, chickenRelation, shRelation;
+
+		void computePO();
+		void computeRanks();
+		void computeRelations();
+		bool isDominatedBy(int, int) const;
+		bool bosCondition(int, int) const;
+		bool chickenCondition(int, int) const;
+		bool shCondition(int, int) const;
+		int withStrats(int, int, int) const;
+	public:
+		GameFeatures(const vector<int> &, const vector<T> &);
+
+		int getNumEquilibria() const				{ return equilibria.size(); }
+		int getNumOutcomes() const					{ return numOutcomes; }
+		int getNumParetoEquilibria() const			{ return numParetoEquilibria; }
+		int getNumPlayers() const					{ return numPlayers; }
+		int getNumStrats(int x) const				{ return numStrats.at(x); }
+		int getEquilibrium(int n) const				{ return equilibria.at(n); }
+		int getRank(int x, int o) const				{ return ranks.at(x).at(o); }
+		T getPayoff(int o, int x) const				{ return payoffs.at(o * numPlayers + x); }
+		bool getAllPO() const						{ return allPO; }
+		bool getConstantSum() const					{ return constantSum; }
+		bool getCoordination() const				{ return coordination; }
+		bool isParetoEquilibrium(int n) const		{ return paretoEquilibria.at(n); }
+
+		bool isBOS() const;
+		bool isChicken() const;
+		bool isIH() const;
+		bool isNull() const;
+		bool isPC() const;
+		bool isPD() const;
+		bool isPO(int) const;
+		bool isSH() const;
+		bool isStrictlyDominant(int, int) const;
+		bool isWeaklyDominant(int, int) const;
+		bool isZS() const;
+		int outcome(const vector<int> &) const;
+		vector<int> profile(int) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor: computes the whole feature vector
+template <typename T>
+GameFeatures<T>::GameFeatures(const vector<int> &nS, const vector<T> &p)
+{
+	numPlayers = nS.size();
+	numStrats = nS;
+	payoffs = p;
+
+	strides = vector<int>(numPlayers);
+	numOutcomes = 1;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		strides.at(x) = numOutcomes;
+		numOutcomes *= numStrats.at(x);
+	}
+
+	/*
+		pass over the payoffs: constant-sum and constant payoffs, and the maximum of
+		each best-response slice, keyed by the outcome where P_x plays s_1
+	*/
+	vector<T> sliceMax = vector<T>(numOutcomes * numPlayers);
+	vector<int> sliceBRs = vector<int>(numOutcomes * numPlayers, 0);
+	vector<int> prof = vector<int>(numPlayers, 0);
+	T firstSum = 0;
+
+	constantSum = true;
+	constantPayoffs = true;
+	for (int o = 0; o < numOutcomes; o++)
+	{
+		T sum = 0;
+		for (int x = 0; x < numPlayers; x++)
+		{
+			T val = payoffs.at(o * numPlayers + x);
+			sum += val;
+			if (val != payoffs.at(x))
+				constantPayoffs = false;
+
+			int base = o - prof.at(x) * strides.at(x);
+			if (prof.at(x) == 0 || val > sliceMax.at(base * numPlayers + x))
+				sliceMax.at(base * numPlayers + x) = val;
+		}
+		if (o == 0)
+			firstSum = sum;
+		else if (sum != firstSum)
+			constantSum = false;
+
+		// next profile
+		for (int x = 0; x < numPlayers; x++)
+		{
+			prof.at(x)++;
+			if (prof.at(x) < numStrats.at(x))
+				break;
+			prof.at(x) = 0;
+		}
+	}
+
+	// pass over the slices: best responses, equilibria and dominance
+	brEverywhere = vector<vector<bool> >(numPlayers);
+	uniqueBRs = vector<bool>(numPlayers, true);
+	for (int x = 0; x < numPlayers; x++)
+		brEverywhere.at(x) = vector<bool>(numStrats.at(x), true);
+
+	prof = vector<int>(numPlayers, 0);
+	for (int o = 0; o < numOutcomes; o++)
+	{
+		bool isEquilibrium = true;
+		for (int x = 0; x < numPlayers; x++)
+		{
+			int base = o - prof.at(x) * strides.at(x);
+			if (payoffs.at(o * numPlayers + x) == sliceMax.at(base * numPlayers + x))
+				sliceBRs.at(base * numPlayers + x)++;
+			else
+			{
+				isEquilibrium = false;
+				brEverywhere.at(x).at(prof.at(x)) = false;
+			}
+		}
+		if (isEquilibrium)
+			equilibria.push_back(o);
+
+		for (int x = 0; x < numPlayers; x++)
+		{
+			prof.at(x)++;
+			if (prof.at(x) < numStrats.at(x))
+				break;
+			prof.at(x) = 0;
+		}
+	}
+
+	// slices are identified by their base outcome (P_x plays s_1)
+	prof = vector<int>(numPlayers, 0);
+	for (int o = 0; o < numOutcomes; o++)
+	{
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (prof.at(x) == 0)
+			{
+				if (sliceBRs.at(o * numPlayers + x) != 1)
+					uniqueBRs.at(x) = false;
+			}
+		}
+		for (int x = 0; x < numPlayers; x++)
+		{
+			prof.at(x)++;
+			if (prof.at(x) < numStrats.at(x))
+				break;
+			prof.at(x) = 0;
+		}
+	}
+
+	computePO();
+	numParetoEquilibria = 0;
+	paretoEquilibria = vector<bool>(equilibria.size());
+	for (int n = 0; (unsigned)n < equilibria.size(); n++)
+	{
+		paretoEquilibria.at(n) = isPO(equilibria.at(n));
+		if (paretoEquilibria.at(n))
+			numParetoEquilibria++;
+	}
+
+	computeRanks();
+	computeRelations();
+}
+
+/*
+	Pareto frontier sweep. Outcomes are sorted by their payoffs in decreasing
+	lexicographic order, so anything that Pareto-dominates o comes before o.
+
+	With 2 players, o is Pareto-optimal if it has the largest P_2 payoff among
+	the outcomes with its P_1 payoff, and that payoff beats every P_2 payoff
+	with a larger P_1 payoff. That is one running maximum, O(numOutcomes log
+	numOutcomes) overall.
+
+	With more players, o is compared with the Pareto-optimal outcomes found so
+	far. Anything that dominates o is dominated by one of those, or is one. That
+	is O(numOutcomes * size of the frontier), which is O(numOutcomes^2) only when
+	nearly every outcome is Pareto-optimal.
+*/
+template <typename T>
+void GameFeatures<T>::computePO()
+{
+	po = vector<bool>(numOutcomes, true);
+	allPO = true;
+	if (constantSum) // no outcome can make someone better off without making someone worse off
+		return;
+
+	vector<int> order = vector<int>(numOutcomes);
+	for (int o = 0; o < numOutcomes; o++)
+		order.at(o) = o;
+	sort(order.begin(), order.end(), [this](int a, int b)
+	{
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (getPayoff(a, x) != getPayoff(b, x))
+				return getPayoff(b, x) < getPayoff(a, x);
+		}
+		return false;
+	});
+
+	if (numPlayers == 2)
+	{
+		bool anyAbove = false;
+		T bestAbove = 0; // largest P_2 payoff with a larger P_1 payoff
+		int n = 0;
+		while (n < numOutcomes)
+		{
+			// outcomes with the same P_1 payoff, the largest P_2 payoff first
+			int groupEnd = n;
+			T groupMax = getPayoff(order.at(n), 1);
+			while (groupEnd < numOutcomes && getPayoff(order.at(groupEnd), 0) == getPayoff(order.at(n), 0))
+			{
+				T val = getPayoff(order.at(groupEnd), 1);
+				po.at(order.at(groupEnd)) = val == groupMax && (!anyAbove || bestAbove < val);
+				groupEnd++;
+			}
+			if (!anyAbove || bestAbove < groupMax)
+				bestAbove = groupMax;
+			anyAbove = true;
+			n = groupEnd;
+		}
+	}
+	else
+	{
+		vector<int> frontier;
+		for (int n = 0; n < numOutcomes; n++)
+		{
+			int o = order.at(n);
+			for (int f = frontier.size() - 1; f >= 0 && po.at(o); f--)
+			{
+				if (isDominatedBy(o, frontier.at(f)))
+					po.at(o) = false;
+			}
+			if (po.at(o))
+				frontier.push_back(o);
+		}
+	}
+
+	for (int o = 0; o < numOutcomes; o++)
+	{
+		if (!po.at(o))
+			allPO = false;
+	}
+}
+
+// dense ordinal ranks of each player's payoffs
+template <typename T>
+void GameFeatures<T>::computeRanks()
+{
+	vector<T> values = vector<T>(numOutcomes);
+	ranks = vector<vector<int> >(numPlayers, vector<int>(numOutcomes));
+	for (int x = 0; x < numPlayers; x++)
+	{
+		for (int o = 0; o < numOutcomes; o++)
+			values.at(o) = payoffs.at(o * numPlayers + x);
+		sort(values.begin(), values.end());
+		values.erase(unique(values.begin(), values.end()), values.end());
+
+		for (int o = 0; o < numOutcomes; o++)
+			ranks.at(x).at(o) = lower_bound(values.begin(), values.end(), payoffs.at(o * numPlayers + x)) - values.begin();
+
+		values.resize(numOutcomes);
+	}
+}
+
+// relations between equilibria used by the named 2-player types
+template <typename T>
+void GameFeatures<T>::computeRelations()
+{
+	coordination = true;
+	equalEquilibria = true;
+	for (int n = 0; (unsigned)n < equilibria.size(); n++)
+	{
+		vector<int> eq = profile(equilibria.at(n));
+		for (int x = 1; x < numPlayers; x++)
+		{
+			if (eq.at(x) != eq.at(0))
+				coordination = false;
+		}
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (getPayoff(equilibria.at(n), x) != getPayoff(equilibria.at(0), x))
+				equalEquilibria = false;
+		}
+	}
+
+	distinctDiagonal = true;
+	if (numPlayers >= 2)
+	{
+		for (int o = 0; o < numOutcomes; o += strides.at(1) * numStrats.at(1)) // each P_1/P_2 slice
+		{
+			for (int i = 0; i < numStrats.at(0) && i < numStrats.at(1); i++)
+				for (int a = i + 1; a < numStrats.at(0) && a < numStrats.at(1); a++)
+				{
+					int d1 = withStrats(o, i, i);
+					int d2 = withStrats(o, a, a);
+					if (getPayoff(d1, 0) == getPayoff(d2, 0) && getPayoff(d1, 1) == getPayoff(d2, 1))
+						distinctDiagonal = false;
+				}
+		}
+	}
+
+	bosRelation = chickenRelation = shRelation = equilibria.size() > 1 && numPlayers >= 2;
+	for (int a = 0; (unsigned)a < equilibria.size(); a++)
+		for (int b = a + 1; (unsigned)b < equilibria.size(); b++)
+		{
+			if (!bosCondition(equilibria.at(a), equilibria.at(b)))
+				bosRelation = false;
+			if (!chickenCondition(equilibria.at(a), equilibria.at(b)))
+				chickenRelation = false;
+
+			bool same = true;
+			for (int x = 0; x < numPlayers; x++)
+			{
+				if (getPayoff(equilibria.at(a), x) != getPayoff(equilibria.at(b), x))
+					same = false;
+			}
+			if (same || !shCondition(equilibria.at(a), equilibria.at(b)))
+				shRelation = false;
+		}
+}
+
+// outcome o with P_1 playing i and P_2 playing j
+template <typename T>
+int GameFeatures<T>::withStrats(int o, int i, int j) const
+{
+	vector<int> prof = profile(o);
+	return o + (i - prof.at(0)) * strides.at(0) + (j - prof.at(1)) * strides.at(1);
+}
+
+// o is Pareto-dominated by d
+template <typename T>
+bool GameFeatures<T>::isDominatedBy(int o, int d) const
+{
+	bool oneBetter = false;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		if (getPayoff(d, x) < getPayoff(o, x))
+			return false;
+		if (getPayoff(d, x) > getPayoff(o, x))
+			oneBetter = true;
+	}
+	return oneBetter;
+}
+
+// Battle of the Sexes: the players disagree about which equilibrium is better
+template <typename T>
+bool GameFeatures<T>::bosCondition(int e1, int e2) const
+{
+	T X = getPayoff(e1, 0), Y = getPayoff(e1, 1);
+	T W = getPayoff(e2, 0), Z = getPayoff(e2, 1);
+	return (W < X && Y < Z) || (X < W && Z < Y);
+}
+
+// Chicken relation between equilibria
+template <typename T>
+bool GameFeatures<T>::chickenCondition(int e1, int e2) const
+{
+	vector<int> eq1 = profile(e1), eq2 = profile(e2);
+	T X = getPayoff(e1, 0), Y = getPayoff(e1, 1);
+	T W = getPayoff(e2, 0), Z = getPayoff(e2, 1);
+
+	if (X > W)
+	{
+		// U < W < X, V < Y < Z
+		for (int i = 0; i < numStrats.at(0); i++)
+		{
+			if (i != eq1.at(0) && i != eq2.at(0)
+				&& (getPayoff(withStrats(e2, i, eq2.at(1)), 0) == W || getPayoff(withStrats(e1, i, eq1.at(1)), 1) == Y))
+				return false;
+		}
+		for (int j = 0; j < numStrats.at(1); j++)
+		{
+			if (j != eq1.at(1) && j != eq2.at(1)
+				&& (getPayoff(withStrats(e1, eq1.at(0), j), 1) == Y || getPayoff(withStrats(e2, eq2.at(0), j), 0) == W))
+				return false;
+		}
+	}
+	else
+	{
+		// U < Z < Y, V < X < W
+		for (int i = 0; i < numStrats.at(0); i++)
+		{
+			if (i != eq1.at(0) && i != eq2.at(0)
+				&& (getPayoff(withStrats(e2, i, eq2.at(1)), 1) == Z || getPayoff(withStrats(e1, i, eq1.at(1)), 0) == X))
+				return false;
+		}
+		for (int j = 0; j < numStrats.at(1); j++)
+		{
+			if (j != eq1.at(1) && j != eq2.at(1)
+				&& (getPayoff(withStrats(e1, eq1.at(0), j), 0) == X || getPayoff(withStrats(e2, eq2.at(0), j), 1) == Z))
+				return false;
+		}
+	}
+	return (W < X && Y < Z) || (X < W && Z < Y);
+}
+
+// Stag Hunt relation: each player is guaranteed the payoff of the non-PO equilibrium
+template <typename T>
+bool GameFeatures<T>::shCondition(int e1, int e2) const
+{
+	vector<int> eq1 = profile(e1), eq2 = profile(e2);
+	T X = getPayoff(e1, 0), Y = getPayoff(e1, 1);
+	T W = getPayoff(e2, 0), Z = getPayoff(e2, 1);
+
+	// the safe equilibrium's payoffs are guaranteed, the other's are the best
+	int safe = e2, risky = e1;
+	T safe1 = W, safe2 = Z, risky1 = X, risky2 = Y;
+	if (!(X > W))
+	{
+		safe = e1;
+		risky = e2;
+		safe1 = X;
+		safe2 = Y;
+		risky1 = W;
+		risky2 = Z;
+	}
+	vector<int> safeEq = profile(safe), riskyEq = profile(risky);
+
+	for (int i = 0; i < numStrats.at(0); i++)
+	{
+		if (getPayoff(withStrats(safe, i, safeEq.at(1)), 1) != safe2)
+			return false;
+	}
+	for (int j = 0; j < numStrats.at(1); j++)
+	{
+		if (getPayoff(withStrats(safe, safeEq.at(0), j), 0) != safe1)
+			return false;
+	}
+
+	// U < W < X
+	for (int i = 0; i < numStrats.at(0); i++)
+	{
+		if (i != eq1.at(0) && i != eq2.at(0)
+			&& (getPayoff(withStrats(safe, i, safeEq.at(1)), 0) == safe1 || getPayoff(withStrats(risky, i, riskyEq.at(1)), 0) == risky1))
+			return false;
+	}
+
+	// V < Z < Y
+	for (int j = 0; j < numStrats.at(1); j++)
+	{
+		if (j != eq1.at(1) && j != eq2.at(1)
+			&& (getPayoff(withStrats(safe, safeEq.at(0), j), 1) == safe2 || getPayoff(withStrats(risky, riskyEq.at(0), j), 1) == risky2))
+			return false;
+	}
+
+	return (W < X && Z < Y) || (X < W && Y < Z);
+}
+
+// Battle of the Sexes
+template <typename T>
+bool GameFeatures<T>::isBOS() const
+{
+	return equilibria.size() == 2 && numParetoEquilibria == 2 && coordination && bosRelation;
+}
+
+// Chicken
+template <typename T>
+bool GameFeatures<T>::isChicken() const
+{
+	return equilibria.size() == 2 && numParetoEquilibria > 1 && !coordination && chickenRelation && distinctDiagonal;
+}
+
+// Invisible Hand: one PO equilibrium of strictly dominant strategies
+template <typename T>
+bool GameFeatures<T>::isIH() const
+{
+	if (equilibria.size() != 1 || isNull() || !paretoEquilibria.at(0))
+		return false;
+
+	vector<int> eq = profile(equilibria.at(0));
+	for (int x = 0; x < numPlayers; x++)
+	{
+		if (!isStrictlyDominant(x, eq.at(x)))
+			return false;
+	}
+	return true;
+}
+
+// Null: every outcome is an equilibrium with the same payoffs
+template <typename T>
+bool GameFeatures<T>::isNull() const
+{
+	return constantPayoffs && (int)equilibria.size() == numOutcomes;
+}
+
+// Pure Coordination: multiple PO equilibria with equal payoffs
+template <typename T>
+bool GameFeatures<T>::isPC() const
+{
+	return equilibria.size() > 1 && numParetoEquilibria > 1 && equalEquilibria && !isNull();
+}
+
+// Prisoner's Dilemma: non-PO equilibria of weakly dominant strategies
+template <typename T>
+bool GameFeatures<T>::isPD() const
+{
+	if (equilibria.size() == 0 || (int)equilibria.size() <= numParetoEquilibria)
+		return false;
+
+	for (int n = 0; (unsigned)n < equilibria.size(); n++)
+	{
+		if (paretoEquilibria.at(n))
+			return false;
+		vector<int> eq = profile(equilibria.at(n));
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (!isWeaklyDominant(x, eq.at(x)))
+				return false;
+		}
+	}
+	return true;
+}
+
+// checks if outcome o is Pareto-optimal
+template <typename T>
+bool GameFeatures<T>::isPO(int o) const
+{
+	return po.at(o);
+}
+
+// Stag Hunt
+template <typename T>
+bool GameFeatures<T>::isSH() const
+{
+	return equilibria.size() > 1 && numParetoEquilibria > 0 && (int)equilibria.size() > numParetoEquilibria
+		&& coordination && shRelation;
+}
+
+// s is P_x's unique best response to every profile
+template <typename T>
+bool GameFeatures<T>::isStrictlyDominant(int x, int s) const
+{
+	return brEverywhere.at(x).at(s) && uniqueBRs.at(x);
+}
+
+/*
+	s is at least as good as every other strategy t against every profile, and
+	strictly better than each t somewhere. s is a best response everywhere, so
+	it beats t exactly where t isn't one, which is somewhere unless t is a best
+	response everywhere too. A player's only strategy dominates nothing.
+*/
+template <typename T>
+bool GameFeatures<T>::isWeaklyDominant(int x, int s) const
+{
+	if (numStrats.at(x) < 2 || !brEverywhere.at(x).at(s))
+		return false;
+	for (int t = 0; t < numStrats.at(x); t++)
+	{
+		if (t != s && brEverywhere.at(x).at(t))
+			return false;
+	}
+	return true;
+}
+
+// Zero-Sum: every outcome is PO
+template <typename T>
+bool GameFeatures<T>::isZS() const
+{
+	return !isNull() && allPO;
+}
+
+// converts a strategy profile into its outcome index
+template <typename T>
+int GameFeatures<T>::outcome(const vector<int> &prof) const
+{
+	int o = 0;
+	for (int x = 0; x < numPlayers; x++)
+		o += prof.at(x) * strides.at(x);
+	return o;
+}
+
+// converts an outcome index into its strategy profile
+template <typename T>
+vector<int> GameFeatures<T>::profile(int o) const
+{
+	vector<int> prof = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		prof.at(x) = o % numStrats.at(x);
+		o /= numStrats.at(x);
+	}
+	return prof;
+}
+
+#endif
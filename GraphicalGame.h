@@ -0,0 +1,504 @@
+/*************************************************
+Title: GraphicalGame.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: graphical and polymatrix games, where
+		 payoffs depend only on neighbours
+**************************************************/
+
+#ifndef GRAPHICALGAME_H
+#define GRAPHICALGAME_H
+
+#include <algorithm>
+#include <deque>
+#include "SimGame.h"
+
+/*
+	A game on an interaction graph. P_x's payoff is a local table over their own
+	strategy and their neighbours' strategies, plus a matrix for each polymatrix edge
+	(x, y) that only looks at x's and y's strategies. Either part can be left out, so
+	this covers graphical games, polymatrix games and mixtures. Storage is the sum of
+	the local tables and edge matrices rather than the product of everyone's strategy
+	counts, so hundreds of players are fine as long as degrees are small.
+
+	Payoffs, best responses and expected payoffs only touch a player's own neighbours
+	and edges. Each player also keeps the players whose payoffs depend on them, so
+	best-response dynamics only recheck those after a change, and the equilibrium
+	search checks a player as soon as everyone they depend on has a strategy.
+*/
+template <typename T>
+class GraphicalGame
+{
+	private:
+		int numPlayers;
+		vector<int> numStrats;
+		vector<vector<int> > neighbors; // players in P_x's local table, in table order
+		vector<vector<int> > strides; // index stride of each neighbour in P_x's local table
+		vector<vector<T> > localPayoffs; // own strategy fastest, empty if P_x has no table
+		vector<vector<int> > partners; // polymatrix edges out of P_x
+		vector<vector<vector<T> > > edgePayoffs; // P_x's matrix for each edge, s_x + numStrats_x * s_y
+		vector<vector<int> > dependents; // players whose payoffs depend on P_x
+
+		void addDependent(int, int);
+		vector<T> computeStratPayoffs(const vector<int> &, int) const;
+	public:
+		GraphicalGame(const vector<int> &);
+
+		vector<int> getNeighbors(int x) const	{ return neighbors.at(x); }
+		int getNumPlayers() const				{ return numPlayers; }
+		int getNumStrats(int x) const			{ return numStrats.at(x); }
+
+		vector<int> computeBestResponses(const vector<int> &, int) const;
+		int computeBestResponseDynamics(vector<int> &, int) const;
+		vector<double> computeExpectedPayoffs(const vector<vector<double> > &, int) const;
+		double computeExpectedUtility(const vector<vector<double> > &, int) const;
+		vector<vector<int> > computePureEquilibria(int) const;
+		long long getNumEntries() const;
+		T getPayoff(const vector<int> &, int) const;
+		bool isPureEquilibrium(const vector<int> &) const;
+		void printPureEquilibria(int) const;
+		void randGame();
+		void setEdgePayoff(int, int, int, int, T);
+		void setLocalPayoff(int, const vector<int> &, T);
+		bool setNeighbors(int, const vector<int> &);
+		simGame<T>* toSimGame() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, one entry per player with their number of strategies, and no payoffs yet
+template <typename T>
+GraphicalGame<T>::GraphicalGame(const vector<int> &nS)
+{
+	numPlayers = nS.size();
+	numStrats = nS;
+	neighbors = vector<vector<int> >(numPlayers);
+	strides = vector<vector<int> >(numPlayers);
+	localPayoffs = vector<vector<T> >(numPlayers);
+	partners = vector<vector<int> >(numPlayers);
+	edgePayoffs = vector<vector<vector<T> > >(numPlayers);
+	dependents = vector<vector<int> >(numPlayers);
+}
+
+// x's payoff depends on y
+template <typename T>
+void GraphicalGame<T>::addDependent(int y, int x)
+{
+	if (find(dependents.at(y).begin(), dependents.at(y).end(), x) == dependents.at(y).end())
+		dependents.at(y).push_back(x);
+}
+
+// P_x's best responses to everyone else's strategies in profile
+template <typename T>
+vector<int> GraphicalGame<T>::computeBestResponses(const vector<int> &profile, int x) const
+{
+	vector<T> payoffs = computeStratPayoffs(profile, x);
+	vector<int> best;
+	T max = payoffs.at(0);
+
+	for (int s = 1; s < numStrats.at(x); s++)
+	{
+		if (payoffs.at(s) > max)
+			max = payoffs.at(s);
+	}
+	for (int s = 0; s < numStrats.at(x); s++)
+	{
+		if (payoffs.at(s) == max)
+			best.push_back(s);
+	}
+	return best;
+}
+
+/*
+	Moves players who aren't best responding to their lowest best response, one at a
+	time, until nobody wants to move or maxMoves moves have been made. Only the
+	dependents of a player who moved go back on the queue. Returns the number of moves,
+	or -1 if it ran out; profile is left wherever the dynamics stopped.
+*/
+template <typename T>
+int GraphicalGame<T>::computeBestResponseDynamics(vector<int> &profile, int maxMoves) const
+{
+	deque<int> queue;
+	vector<bool> queued = vector<bool>(numPlayers, true);
+	int moves = 0;
+
+	for (int x = 0; x < numPlayers; x++)
+		queue.push_back(x);
+	while (!queue.empty())
+	{
+		int x = queue.front();
+		queue.pop_front();
+		queued.at(x) = false;
+
+		vector<int> best = computeBestResponses(profile, x);
+		if (find(best.begin(), best.end(), profile.at(x)) != best.end())
+			continue;
+		if (moves == maxMoves)
+			return -1;
+
+		profile.at(x) = best.at(0);
+		moves++;
+		for (int d = 0; (unsigned)d < dependents.at(x).size(); d++)
+		{
+			int y = dependents.at(x).at(d);
+			if (!queued.at(y))
+			{
+				queued.at(y) = true;
+				queue.push_back(y);
+			}
+		}
+	}
+	return moves;
+}
+
+/*
+	Expected payoff of each of P_x's strategies when everyone plays the mixed strategies
+	in sigma. The local table is summed over the neighbours' profiles and each edge is a
+	matrix-vector product, so nobody outside P_x's neighbourhood is looked at.
+*/
+template <typename T>
+vector<double> GraphicalGame<T>::computeExpectedPayoffs(const vector<vector<double> > &sigma, int x) const
+{
+	int nS = numStrats.at(x);
+	vector<double> expected = vector<double>(nS, 0.0);
+
+	if (!localPayoffs.at(x).empty())
+	{
+		int degree = neighbors.at(x).size();
+		vector<int> local = vector<int>(degree, 0);
+		int index = 0;
+		while (true)
+		{
+			double probability = 1.0;
+			for (int k = 0; k < degree && probability != 0.0; k++)
+				probability *= sigma.at(neighbors.at(x).at(k)).at(local.at(k));
+			if (probability != 0.0)
+				for (int s = 0; s < nS; s++)
+					expected.at(s) += probability * static_cast<double>(localPayoffs.at(x).at(index + s));
+
+			int k = 0;
+			while (k < degree && local.at(k) == numStrats.at(neighbors.at(x).at(k)) - 1)
+			{
+				local.at(k) = 0;
+				k++;
+			}
+			if (k == degree)
+				break;
+			local.at(k)++;
+			index = 0;
+			for (int l = 0; l < degree; l++)
+				index += local.at(l) * strides.at(x).at(l);
+		}
+	}
+
+	for (int e = 0; (unsigned)e < partners.at(x).size(); e++)
+	{
+		const vector<double> &other = sigma.at(partners.at(x).at(e));
+		for (int t = 0; (unsigned)t < other.size(); t++)
+		{
+			if (other.at(t) == 0.0)
+				continue;
+			for (int s = 0; s < nS; s++)
+				expected.at(s) += other.at(t) * static_cast<double>(edgePayoffs.at(x).at(e).at(s + nS * t));
+		}
+	}
+	return expected;
+}
+
+// P_x's expected payoff when everyone plays the mixed strategies in sigma
+template <typename T>
+double GraphicalGame<T>::computeExpectedUtility(const vector<vector<double> > &sigma, int x) const
+{
+	vector<double> expected = computeExpectedPayoffs(sigma, x);
+	double utility = 0.0;
+
+	for (int s = 0; s < numStrats.at(x); s++)
+		utility += sigma.at(x).at(s) * expected.at(s);
+	return utility;
+}
+
+/*
+	Up to maxEquilibria pure equilibria, by backtracking over the players in
+	breadth-first order. A player is checked as soon as they and everyone they depend on
+	have strategies, so on sparse graphs most partial profiles are cut off after a few
+	players. The worst case is still exponential, as it has to be.
+*/
+template <typename T>
+vector<vector<int> > GraphicalGame<T>::computePureEquilibria(int maxEquilibria) const
+{
+	vector<vector<int> > equilibria;
+	vector<int> order, position = vector<int>(numPlayers, -1);
+
+	// breadth-first over the dependency graph in both directions keeps neighbours close in the order
+	for (int root = 0; root < numPlayers; root++)
+	{
+		if (position.at(root) != -1)
+			continue;
+		position.at(root) = order.size();
+		order.push_back(root);
+		for (int i = order.size() - 1; (unsigned)i < order.size(); i++)
+		{
+			int x = order.at(i);
+			vector<int> adjacent = dependents.at(x);
+			adjacent.insert(adjacent.end(), neighbors.at(x).begin(), neighbors.at(x).end());
+			adjacent.insert(adjacent.end(), partners.at(x).begin(), partners.at(x).end());
+			for (int a = 0; (unsigned)a < adjacent.size(); a++)
+			{
+				if (position.at(adjacent.at(a)) == -1)
+				{
+					position.at(adjacent.at(a)) = order.size();
+					order.push_back(adjacent.at(a));
+				}
+			}
+		}
+	}
+
+	// checks.at(i) holds the players who can be checked once order.at(i) has a strategy
+	vector<vector<int> > checks = vector<vector<int> >(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		int last = position.at(x);
+		for (int k = 0; (unsigned)k < neighbors.at(x).size(); k++)
+			last = max(last, position.at(neighbors.at(x).at(k)));
+		for (int e = 0; (unsigned)e < partners.at(x).size(); e++)
+			last = max(last, position.at(partners.at(x).at(e)));
+		checks.at(last).push_back(x);
+	}
+
+	vector<int> profile = vector<int>(numPlayers, 0);
+	vector<int> next = vector<int>(numPlayers + 1, 0); // next strategy to try at each depth
+	int depth = 0;
+	while (depth >= 0 && (int)equilibria.size() < maxEquilibria)
+	{
+		if (depth == numPlayers)
+		{
+			equilibria.push_back(profile);
+			depth--;
+			continue;
+		}
+
+		int x = order.at(depth);
+		if (next.at(depth) == numStrats.at(x))
+		{
+			next.at(depth) = 0;
+			depth--;
+			continue;
+		}
+		profile.at(x) = next.at(depth);
+		next.at(depth)++;
+
+		bool consistent = true;
+		for (int c = 0; (unsigned)c < checks.at(depth).size() && consistent; c++)
+		{
+			int y = checks.at(depth).at(c);
+			vector<T> payoffs = computeStratPayoffs(profile, y);
+			for (int s = 0; s < numStrats.at(y); s++)
+			{
+				if (payoffs.at(s) > payoffs.at(profile.at(y)))
+				{
+					consistent = false;
+					break;
+				}
+			}
+		}
+		if (consistent)
+			depth++;
+	}
+	return equilibria;
+}
+
+// P_x's payoff for each of their strategies with everyone else as in profile
+template <typename T>
+vector<T> GraphicalGame<T>::computeStratPayoffs(const vector<int> &profile, int x) const
+{
+	int nS = numStrats.at(x);
+	vector<T> payoffs = vector<T>(nS, T(0));
+
+	if (!localPayoffs.at(x).empty())
+	{
+		int index = 0;
+		for (int k = 0; (unsigned)k < neighbors.at(x).size(); k++)
+			index += profile.at(neighbors.at(x).at(k)) * strides.at(x).at(k);
+		for (int s = 0; s < nS; s++)
+			payoffs.at(s) = localPayoffs.at(x).at(index + s);
+	}
+	for (int e = 0; (unsigned)e < partners.at(x).size(); e++)
+	{
+		int column = nS * profile.at(partners.at(x).at(e));
+		for (int s = 0; s < nS; s++)
+			payoffs.at(s) += edgePayoffs.at(x).at(e).at(column + s);
+	}
+	return payoffs;
+}
+
+// number of payoffs stored, local tables plus edge matrices
+template <typename T>
+long long GraphicalGame<T>::getNumEntries() const
+{
+	long long entries = 0;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		entries += localPayoffs.at(x).size();
+		for (int e = 0; (unsigned)e < edgePayoffs.at(x).size(); e++)
+			entries += edgePayoffs.at(x).at(e).size();
+	}
+	return entries;
+}
+
+template <typename T>
+T GraphicalGame<T>::getPayoff(const vector<int> &profile, int x) const
+{
+	T payoff = T(0);
+	int nS = numStrats.at(x);
+
+	if (!localPayoffs.at(x).empty())
+	{
+		int index = profile.at(x);
+		for (int k = 0; (unsigned)k < neighbors.at(x).size(); k++)
+			index += profile.at(neighbors.at(x).at(k)) * strides.at(x).at(k);
+		payoff = localPayoffs.at(x).at(index);
+	}
+	for (int e = 0; (unsigned)e < partners.at(x).size(); e++)
+		payoff += edgePayoffs.at(x).at(e).at(profile.at(x) + nS * profile.at(partners.at(x).at(e)));
+	return payoff;
+}
+
+template <typename T>
+bool GraphicalGame<T>::isPureEquilibrium(const vector<int> &profile) const
+{
+	for (int x = 0; x < numPlayers; x++)
+	{
+		vector<T> payoffs = computeStratPayoffs(profile, x);
+		for (int s = 0; s < numStrats.at(x); s++)
+		{
+			if (payoffs.at(s) > payoffs.at(profile.at(x)))
+				return false;
+		}
+	}
+	return true;
+}
+
+/*
+	Pure Equilibria (first 2):
+	(s_1, s_2, s_1, ...)
+*/
+template <typename T>
+void GraphicalGame<T>::printPureEquilibria(int maxEquilibria) const
+{
+	vector<vector<int> > equilibria = computePureEquilibria(maxEquilibria);
+
+	cout << "\nPure Equilibria (first " << maxEquilibria << "):\n";
+	if (equilibria.empty())
+		cout << "none\n";
+	for (int e = 0; (unsigned)e < equilibria.size(); e++)
+	{
+		cout << "(";
+		for (int x = 0; x < numPlayers; x++)
+		{
+			cout << "s_" << equilibria.at(e).at(x) + 1;
+			if (x < numPlayers - 1)
+				cout << ", ";
+		}
+		cout << ")\n";
+	}
+}
+
+// payoffs from 0 to 99 in every local table and edge matrix there is, like simGame::randGame()
+template <typename T>
+void GraphicalGame<T>::randGame()
+{
+	for (int x = 0; x < numPlayers; x++)
+	{
+		for (int i = 0; (unsigned)i < localPayoffs.at(x).size(); i++)
+			localPayoffs.at(x).at(i) = rand() % 100;
+		for (int e = 0; (unsigned)e < edgePayoffs.at(x).size(); e++)
+			for (int i = 0; (unsigned)i < edgePayoffs.at(x).at(e).size(); i++)
+				edgePayoffs.at(x).at(e).at(i) = rand() % 100;
+	}
+}
+
+// P_x's payoff from the polymatrix edge to y when x plays sx and y plays sy, adding the edge if it's new
+template <typename T>
+void GraphicalGame<T>::setEdgePayoff(int x, int y, int sx, int sy, T value)
+{
+	int e = find(partners.at(x).begin(), partners.at(x).end(), y) - partners.at(x).begin();
+	if ((unsigned)e == partners.at(x).size())
+	{
+		partners.at(x).push_back(y);
+		edgePayoffs.at(x).push_back(vector<T>(numStrats.at(x) * numStrats.at(y), T(0)));
+		addDependent(y, x);
+	}
+	edgePayoffs.at(x).at(e).at(sx + numStrats.at(x) * sy) = value;
+}
+
+// local is P_x's strategy followed by the neighbours' strategies in the order setNeighbors() got them
+template <typename T>
+void GraphicalGame<T>::setLocalPayoff(int x, const vector<int> &local, T value)
+{
+	int index = local.at(0);
+	for (int k = 0; (unsigned)k < neighbors.at(x).size(); k++)
+		index += local.at(k + 1) * strides.at(x).at(k);
+	localPayoffs.at(x).at(index) = value;
+}
+
+/*
+	Gives P_x a local table over their strategy and these neighbours', all 0. Replaces
+	any table P_x had; false if it would be too big.
+*/
+template <typename T>
+bool GraphicalGame<T>::setNeighbors(int x, const vector<int> &adjacent)
+{
+	long long size = numStrats.at(x);
+	vector<int> newStrides;
+
+	for (int k = 0; (unsigned)k < adjacent.size(); k++)
+	{
+		if (adjacent.at(k) == x || adjacent.at(k) < 0 || adjacent.at(k) >= numPlayers)
+		{
+			cout << "ERROR: P_" << x + 1 << " can't have neighbour " << adjacent.at(k) + 1 << endl;
+			return false;
+		}
+		newStrides.push_back(size);
+		size *= numStrats.at(adjacent.at(k));
+		if (size > (1LL << 26))
+		{
+			cout << "ERROR: P_" << x + 1 << "'s local table would be too big\n";
+			return false;
+		}
+	}
+
+	neighbors.at(x) = adjacent;
+	strides.at(x) = newStrides;
+	localPayoffs.at(x) = vector<T>(size, T(0));
+	for (int k = 0; (unsigned)k < adjacent.size(); k++)
+		addDependent(adjacent.at(k), x);
+	return true;
+}
+
+// the full normal form, so only for small games
+template <typename T>
+simGame<T>* GraphicalGame<T>::toSimGame() const
+{
+	simGame<T>* game = new simGame<T>(numPlayers);
+	vector<int> prof = vector<int>(numPlayers, 0);
+
+	game->setAllNumStrats(numStrats);
+	while (true)
+	{
+		for (int x = 0; x < numPlayers; x++)
+			game->setPayoff(prof, x, getPayoff(prof, x));
+
+		int x = 0;
+		while (x < numPlayers && prof.at(x) == numStrats.at(x) - 1)
+		{
+			prof.at(x) = 0;
+			x++;
+		}
+		if (x == numPlayers)
+			break;
+		prof.at(x)++;
+	}
+	return game;
+}
+
+#endif
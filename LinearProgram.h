@@ -0,0 +1,248 @@
+/*************************************************
+Title: LinearProgram.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: simplex method for zero-sum games and
+		 security strategies in simGame.h
+**************************************************/
+
+#ifndef LINEARPROGRAM_H
+#define LINEARPROGRAM_H
+#include "Rational.h"
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+/*
+	maximize c^T y subject to Ay <= b, y >= 0, with b >= 0
+
+	Since b >= 0, y = 0 is feasible and a single phase of the simplex method
+	is enough. Pivots follow Dantzig's rule, falling back to Bland's rule during
+	long runs of degenerate pivots so that the method terminates on degenerate
+	tableaus, which are common for games. N is double or Rational; eps is the
+	tolerance used when comparing with 0 (0 for Rational).
+*/
+template <typename N>
+class LinearProgram
+{
+	private:
+		int numConstraints;
+		int numVariables;
+		vector<vector<N> > tableau; // numConstraints rows of [A | I | b], then the objective row
+		vector<int> basis; // variable that is basic in each row
+		N eps;
+		N pivotTolerance; // pivots above this are preferred
+		bool solved;
+		bool bounded;
+
+		static const int maxDegeneratePivots = 50;
+
+		bool isNegative(const N &val) const { return val < -eps; }
+		bool isPositive(const N &val) const { return val > eps; }
+		void pivot(int, int);
+	public:
+		LinearProgram(const vector<vector<N> > &, const vector<N> &, const vector<N> &, N);
+
+		bool isBounded() const	{ return bounded; }
+
+		vector<N> getDualSolution() const;
+		N getObjectiveValue() const;
+		vector<N> getSolution() const;
+		bool solve();
+};
+
+// the row player's maxmin strategy, the column player's minmax strategy and the value of the matrix game A
+template <typename N>
+bool solveMatrixGame(const vector<vector<N> > &, vector<N> &, vector<N> &, N &, N);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor
+template <typename N>
+LinearProgram<N>::LinearProgram(const vector<vector<N> > &A, const vector<N> &b, const vector<N> &c, N e)
+{
+	numConstraints = A.size();
+	numVariables = c.size();
+	eps = e;
+	pivotTolerance = e * N(1000);
+	solved = false;
+	bounded = true;
+
+	tableau = vector<vector<N> >(numConstraints + 1, vector<N>(numVariables + numConstraints + 1, N(0)));
+	basis = vector<int>(numConstraints);
+	for (int r = 0; r < numConstraints; r++)
+	{
+		for (int v = 0; v < numVariables; v++)
+			tableau.at(r).at(v) = A.at(r).at(v);
+		tableau.at(r).at(numVariables + r) = N(1); // slack
+		tableau.at(r).at(numVariables + numConstraints) = b.at(r);
+		basis.at(r) = numVariables + r;
+	}
+	for (int v = 0; v < numVariables; v++)
+		tableau.at(numConstraints).at(v) = -c.at(v);
+}
+
+// dual values are the reduced costs of the slack variables
+template <typename N>
+vector<N> LinearProgram<N>::getDualSolution() const
+{
+	vector<N> dual = vector<N>(numConstraints);
+	for (int r = 0; r < numConstraints; r++)
+		dual.at(r) = tableau.at(numConstraints).at(numVariables + r);
+	return dual;
+}
+
+template <typename N>
+N LinearProgram<N>::getObjectiveValue() const
+{
+	return tableau.at(numConstraints).at(numVariables + numConstraints);
+}
+
+template <typename N>
+vector<N> LinearProgram<N>::getSolution() const
+{
+	vector<N> y = vector<N>(numVariables, N(0));
+	for (int r = 0; r < numConstraints; r++)
+	{
+		if (basis.at(r) < numVariables)
+			y.at(basis.at(r)) = tableau.at(r).at(numVariables + numConstraints);
+	}
+	return y;
+}
+
+// pivot on tableau entry (row, col)
+template <typename N>
+void LinearProgram<N>::pivot(int row, int col)
+{
+	int width = numVariables + numConstraints + 1;
+	N p = tableau.at(row).at(col);
+	for (int k = 0; k < width; k++)
+		tableau.at(row).at(k) /= p;
+
+	for (int r = 0; r <= numConstraints; r++)
+	{
+		if (r != row)
+		{
+			N factor = tableau.at(r).at(col);
+			if (factor != N(0))
+			{
+				for (int k = 0; k < width; k++)
+					tableau.at(r).at(k) -= factor * tableau.at(row).at(k);
+			}
+		}
+	}
+	basis.at(row) = col;
+}
+
+// returns false if the LP is unbounded
+template <typename N>
+bool LinearProgram<N>::solve()
+{
+	if (solved)
+		return bounded;
+
+	int width = numVariables + numConstraints;
+	int numDegenerate = 0; // pivots in a row that didn't move off the current vertex
+	while (true)
+	{
+		/*
+			Dantzig's rule: entering variable has the most negative reduced cost. After
+			too many degenerate pivots in a row, Bland's rule takes over (the first
+			negative reduced cost) until the objective improves again.
+		*/
+		bool bland = (numDegenerate >= maxDegeneratePivots);
+		int col = -1;
+		for (int k = 0; k < width && !(bland && col != -1); k++)
+		{
+			if (isNegative(tableau.at(numConstraints).at(k))
+				&& (col == -1 || tableau.at(numConstraints).at(k) < tableau.at(numConstraints).at(col)))
+				col = k;
+		}
+		if (col == -1)
+			break; // optimal
+
+		/*
+			ratio test; ties (within eps) go to the smallest basic variable under Bland's
+			rule and otherwise to the largest pivot. Pivots well above eps are preferred
+			and rounding below 0 in b counts as 0, which keeps rounding errors from growing.
+		*/
+		int row = -1;
+		N bestRatio = N(0);
+		for (int pass = 0; pass < 2 && row == -1; pass++)
+		{
+			N minPivot = (pass == 0) ? pivotTolerance : eps;
+			for (int r = 0; r < numConstraints; r++)
+			{
+				if (tableau.at(r).at(col) > minPivot)
+				{
+					N ratio = isPositive(tableau.at(r).at(width)) ? tableau.at(r).at(width) / tableau.at(r).at(col) : N(0);
+					bool tie = (row != -1 && !isNegative(ratio - bestRatio) && !isPositive(ratio - bestRatio));
+					if (row == -1 || isNegative(ratio - bestRatio)
+						|| (tie && (bland ? basis.at(r) < basis.at(row) : tableau.at(row).at(col) < tableau.at(r).at(col))))
+					{
+						row = r;
+						bestRatio = ratio;
+					}
+				}
+			}
+		}
+		if (row == -1)
+		{
+			bounded = false;
+			break;
+		}
+		pivot(row, col);
+		numDegenerate = isPositive(bestRatio) ? 0 : numDegenerate + 1;
+	}
+	solved = true;
+	return bounded;
+}
+
+/*
+	Shifts A so every entry is positive, then solves the column player's LP
+		max sum y  s.t.  A'y <= 1, y >= 0
+	whose optimum is 1/v'. The row player's strategy comes from the dual.
+*/
+template <typename N>
+bool solveMatrixGame(const vector<vector<N> > &A, vector<N> &rowStrategy, vector<N> &colStrategy, N &value, N eps)
+{
+	int rows = A.size();
+	if (rows == 0 || A.at(0).size() == 0)
+		return false;
+	int cols = A.at(0).size();
+
+	N minEntry = A.at(0).at(0);
+	for (int i = 0; i < rows; i++)
+		for (int j = 0; j < cols; j++)
+		{
+			if (A.at(i).at(j) < minEntry)
+				minEntry = A.at(i).at(j);
+		}
+	N shift = N(1) - minEntry;
+
+	vector<vector<N> > shifted = vector<vector<N> >(rows, vector<N>(cols));
+	for (int i = 0; i < rows; i++)
+		for (int j = 0; j < cols; j++)
+			shifted.at(i).at(j) = A.at(i).at(j) + shift;
+
+	LinearProgram<N> lp(shifted, vector<N>(rows, N(1)), vector<N>(cols, N(1)), eps);
+	if (!lp.solve())
+		return false;
+
+	N total = lp.getObjectiveValue(); // 1 / v'
+	N v = N(1) / total;
+
+	colStrategy = lp.getSolution();
+	for (int j = 0; j < cols; j++)
+		colStrategy.at(j) *= v;
+
+	rowStrategy = lp.getDualSolution();
+	for (int i = 0; i < rows; i++)
+		rowStrategy.at(i) *= v;
+
+	value = v - shift;
+	return true;
+}
+
+#endif
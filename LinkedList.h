@@ -8,6 +8,8 @@ Purpose: Linked list class for game theory program
 #define LINKEDLIST_H
 
 #include <iostream>
+#include "ListNode.h"
+#include "NodePool.h"
 using namespace std;
 
 // linked list (payoff matrix entry) of the form [payoff, BR] -> ... -> [payoff, BR]
@@ -15,21 +17,30 @@ template<typename T>
 class LinkedList
 {
 	private:
-		struct ListNode
-		{
-			T value;
-			bool bestResponse;
-			ListNode* next;
-		};
-		ListNode* head;
-		ListNode* tail;
+		ListNode<T>* head;
+		ListNode<T>* tail;
 		int numNodes;
+		NodePool<ListNode<T> >* pool; // where the nodes come from, NULL for new and delete
+		
+		ListNode<T>* makeNode()				{ return pool ? pool->create() : new ListNode<T>; }
+		void freeNode(ListNode<T>* node)	{ if (pool) pool->destroy(node); else delete node; }
 		
 	public:
 		LinkedList()
 		{
 			head = NULL;
 			tail = NULL;
+			pool = NULL;
+			
+			numNodes = 0;
+		}
+		
+		// nodes come from p, e.g., the owning game's pool
+		LinkedList(NodePool<ListNode<T> >* p)
+		{
+			head = NULL;
+			tail = NULL;
+			pool = p;
 			
 			numNodes = 0;
 		}
@@ -44,7 +55,7 @@ class LinkedList
 		void displayPayoffs() const;
 		void displayBRs() const;
 		T getNodeValue(int);
-		void setNodeValue(int, int);
+		void setNodeValue(int, T);
 		bool getNodeBestResponse(int);
 		void setNodeBestResponse(int, bool);
 		void insertNode(T, int);
@@ -54,15 +65,15 @@ class LinkedList
 template<typename T>
 LinkedList<T>::~LinkedList()
 {
-	ListNode* curNode;
-	ListNode* nextNode; // move to succeeding node after delete each curNode
+	ListNode<T>* curNode;
+	ListNode<T>* nextNode; // move to succeeding node after delete each curNode
 	
 	curNode = head;
 	
 	while(curNode) // while not at end
 	{
 		nextNode = curNode->next; // keep track of node after curNode being deleted
-		delete curNode;
+		freeNode(curNode);
 		curNode = nextNode; // move to the next node
 	}
 }
@@ -73,7 +84,7 @@ void LinkedList<T>::appendNode(T nodeValue, bool br)
 {
 	// cout << "APPENDNODE\n";
 	
-	ListNode* newNode = new ListNode;
+	ListNode<T>* newNode = makeNode();
 	newNode->value = nodeValue;
 	newNode->bestResponse = br;
 	newNode->next = NULL;
@@ -98,14 +109,14 @@ void LinkedList<T>::deleteNode(int position)
 	if (!head)
 		return;
 	
-	ListNode* curNode;
-	ListNode* previousNode;
+	ListNode<T>* curNode;
+	ListNode<T>* previousNode;
 	int counter = 0;
 	
 	if (position == 0)
 	{
 		curNode = head->next;
-		delete head;
+		freeNode(head);
 		head = curNode;
 	}
 	else
@@ -124,7 +135,7 @@ void LinkedList<T>::deleteNode(int position)
 				tail = previousNode;
 			
 			previousNode->next = curNode->next;
-			delete curNode;
+			freeNode(curNode);
 		}
 	}
 	numNodes--;
@@ -134,7 +145,7 @@ void LinkedList<T>::deleteNode(int position)
 template<typename T>
 void LinkedList<T>::displayBRs() const
 {
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	
 	if (!head)
 		cout << "The list is empty.\n\n";
@@ -168,7 +179,7 @@ template<typename T>
 void LinkedList<T>::displayList(vector<vector<vector<bool> > > extraSpaces, int m, int j) const // FINISH: spacing for bracketed br notation
 {
 	int x = 0;
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	
 	if (!head)
 		cout << "The list is empty.\n\n";
@@ -218,7 +229,7 @@ void LinkedList<T>::displayList(vector<vector<vector<bool> > > extraSpaces, int
 template<typename T>
 void LinkedList<T>::displayPayoffs() const
 {
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	
 	if (!head)
 		cout << "The list is empty.\n\n";
@@ -242,7 +253,7 @@ void LinkedList<T>::displayPayoffs() const
 template<typename T>
 T LinkedList<T>::getNodeValue(int position)
 {
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	if (!head)
 	{
 		cout << "\t\tERROR (getN 1): list empty\n";
@@ -271,7 +282,7 @@ T LinkedList<T>::getNodeValue(int position)
 template<typename T>
 bool LinkedList<T>::getNodeBestResponse(int position)
 {
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	if (!head)
 	{
 		cout << "ERROR (getBR 1): list empty\n";
@@ -302,7 +313,7 @@ bool LinkedList<T>::getNodeBestResponse(int position)
 template<typename T>
 int LinkedList<T>::getPos(string name) const
 {
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	int pos;
 	
 	curNode = head; // start at beginning
@@ -323,9 +334,9 @@ int LinkedList<T>::getPos(string name) const
 template<typename T>
 void LinkedList<T>::insertNode(T nodeValue, int position)
 {
-	ListNode* curNode;
-	ListNode* newNode = new ListNode;
-	ListNode* prev;
+	ListNode<T>* curNode;
+	ListNode<T>* newNode = makeNode();
+	ListNode<T>* prev;
 	
 	newNode->value = nodeValue;
 	newNode->next = NULL;
@@ -374,7 +385,7 @@ template<typename T>
 void LinkedList<T>::setNodeBestResponse(int position, bool val)
 {
 	// cout << "\tSETNODEBESTRESPONSE\n";
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	if (!head)
 	{
 		cout << "\t\tERROR (setBR 1): list empty\n";
@@ -405,11 +416,11 @@ void LinkedList<T>::setNodeBestResponse(int position, bool val)
 
 // set node value
 template<typename T>
-void LinkedList<T>::setNodeValue(int position, int val)
+void LinkedList<T>::setNodeValue(int position, T val)
 {
 	// cout << "\t\t\tSETNODEVALUE\n";
 	
-	ListNode* curNode;
+	ListNode<T>* curNode;
 	if (!head)
 	{
 		cout << "\t\t\t\tERROR (setVal 1): list is empty\n";
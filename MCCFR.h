@@ -0,0 +1,337 @@
+/*************************************************
+Title: MCCFR.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: external-sampling Monte Carlo CFR for
+		 two-player zero-sum SeqGames
+**************************************************/
+
+#ifndef MCCFR_H
+#define MCCFR_H
+
+#include <random>
+#include "SeqGame.h"
+#include "TaskScheduler.h"
+
+/*
+	External-sampling Monte Carlo counterfactual regret minimization on a SeqGame with
+	information sets, for trees too large for computeSequenceFormSolution(). The game is
+	zero-sum with P_1's payoffs, as there. Each iteration walks the tree once for each
+	player: the traverser tries every action while the opponent's moves are sampled
+	from the current strategy. Regrets and strategy sums are flat arrays indexed by
+	sequence, so the entries of P_x's information set h start at
+	firstSequence.at(x).at(h).
+
+	Iterations run in rounds across threads. During a round the shared tables are only
+	read and each task adds into its own tables, which are reduced into the shared ones
+	when the round ends. Task t draws from a generator seeded with seed + t, so a run is
+	repeatable for a given number of threads and round size.
+*/
+class MCCFR
+{
+	private:
+		const SeqGame *game;
+		SequenceForm form;
+		bool valid;
+		vector<int> actionStart; // node n's actions are actionChildren from actionStart.at(n) to actionStart.at(n + 1)
+		vector<int> actionChildren;
+		vector<double> leafPayoffs; // P_1's payoff at each leaf
+		vector<vector<double> > regrets; // per player and sequence
+		vector<vector<double> > strategySums;
+		long long numIterations;
+		int maxActions;
+		int maxDepth;
+
+		double bestResponseValue(int, const vector<double> &) const;
+		void regretMatching(int, int, double *) const;
+		double traverse(int, int, mt19937 &, vector<vector<double> > &, vector<vector<double> > &, vector<double> &, int) const;
+	public:
+		MCCFR(const SeqGame *);
+
+		long long getNumIterations() const	{ return numIterations; }
+		bool isValid() const				{ return valid; }
+
+		double exploitability() const;
+		double getAverageProbability(int, int, int) const;
+		vector<vector<double> > getAveragePlans() const;
+		void printAverageStrategy() const;
+		void run(long long, int, int, unsigned);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, builds the sequence form and the flat action lists of g
+MCCFR::MCCFR(const SeqGame *g)
+{
+	game = g;
+	numIterations = 0;
+	maxActions = 1;
+	maxDepth = 1;
+	valid = game->computeSequenceForm(form);
+	if (!valid)
+		return;
+
+	int size = form.nodeInfoSets.size();
+	actionStart = vector<int>(size + 1, 0);
+	leafPayoffs = vector<double>(size, 0.0);
+	for (int n = 0; n < size; n++)
+	{
+		actionStart.at(n) = actionChildren.size();
+		if (game->getNode(n).isPlaceholder())
+			continue;
+		for (int s = 0; s < game->getNode(n).getNumChildren(); s++)
+		{
+			if (game->getNext(n, s) != -1)
+				actionChildren.push_back(game->getNext(n, s));
+		}
+		if ((int)actionChildren.size() == actionStart.at(n))
+			leafPayoffs.at(n) = game->getPayoffs(n).at(0);
+		if ((int)actionChildren.size() - actionStart.at(n) > maxActions)
+			maxActions = actionChildren.size() - actionStart.at(n);
+		if (game->getNode(n).getLevel() + 1 > maxDepth)
+			maxDepth = game->getNode(n).getLevel() + 1;
+	}
+	actionStart.at(size) = actionChildren.size();
+
+	regrets = vector<vector<double> >(2);
+	strategySums = vector<vector<double> >(2);
+	for (int x = 0; x < 2; x++)
+	{
+		regrets.at(x) = vector<double>(form.numSequences.at(x), 0.0);
+		strategySums.at(x) = vector<double>(form.numSequences.at(x), 0.0);
+	}
+}
+
+/*
+	P_x's best-response value against the opponent's realization plan, in P_x's payoffs
+	(-P_1's for P_2). Information sets come after the one holding their parent sequence,
+	so a backward pass over them takes the best action everywhere.
+*/
+double MCCFR::bestResponseValue(int x, const vector<double> &opponentPlan) const
+{
+	vector<double> value = vector<double>(form.numSequences.at(x), 0.0);
+	double sign = (x == 0) ? 1.0 : -1.0;
+
+	for (int l = 0; (unsigned)l < form.leafSequences.size(); l++)
+		value.at(form.leafSequences.at(l).at(x)) += sign * form.leafPayoffs.at(l).at(0) * opponentPlan.at(form.leafSequences.at(l).at(1 - x));
+
+	for (int h = form.firstSequence.at(x).size() - 1; h >= 0; h--)
+	{
+		double best = value.at(form.firstSequence.at(x).at(h));
+		for (int a = 1; a < form.numActions.at(x).at(h); a++)
+		{
+			if (value.at(form.firstSequence.at(x).at(h) + a) > best)
+				best = value.at(form.firstSequence.at(x).at(h) + a);
+		}
+		value.at(form.parentSequence.at(x).at(h)) += best;
+	}
+	return value.at(0);
+}
+
+/*
+	How much the players could gain by best responding to each other's average
+	strategies, max_x u(x, y) - min_y u(x, y) for the average plans x and y. It's 0
+	exactly at an equilibrium.
+*/
+double MCCFR::exploitability() const
+{
+	if (!valid)
+		return 0.0;
+
+	vector<vector<double> > plans = getAveragePlans();
+	return bestResponseValue(0, plans.at(1)) + bestResponseValue(1, plans.at(0));
+}
+
+// probability of action a at P_x's information set h in the average strategy, uniform before any play
+double MCCFR::getAverageProbability(int x, int h, int a) const
+{
+	int first = form.firstSequence.at(x).at(h);
+	int k = form.numActions.at(x).at(h);
+	double total = 0.0;
+
+	for (int b = 0; b < k; b++)
+		total += strategySums.at(x).at(first + b);
+	if (total <= 0.0)
+		return 1.0 / k;
+	return strategySums.at(x).at(first + a) / total;
+}
+
+// realization plans of the average strategies
+vector<vector<double> > MCCFR::getAveragePlans() const
+{
+	vector<vector<double> > plans = vector<vector<double> >(2);
+
+	for (int x = 0; x < 2; x++)
+	{
+		plans.at(x) = vector<double>(form.numSequences.at(x), 0.0);
+		plans.at(x).at(0) = 1.0;
+		for (int h = 0; (unsigned)h < form.firstSequence.at(x).size(); h++)
+			for (int a = 0; a < form.numActions.at(x).at(h); a++)
+				plans.at(x).at(form.firstSequence.at(x).at(h) + a) = plans.at(x).at(form.parentSequence.at(x).at(h)) * getAverageProbability(x, h, a);
+	}
+	return plans;
+}
+
+/*
+	Iterations: 10000, exploitability: 0.002
+	P_1 at root: s_1 0.5, s_2 0.5
+*/
+void MCCFR::printAverageStrategy() const
+{
+	if (!valid)
+		return;
+
+	cout << "\nMCCFR average strategy:\n";
+	cout << "--------------------------\n";
+	cout << "Iterations: " << numIterations << ", exploitability: " << exploitability() << endl;
+	for (int x = 0; x < 2; x++)
+		for (int h = 0; (unsigned)h < form.firstSequence.at(x).size(); h++)
+		{
+			int n = form.infoSetNodes.at(x).at(h);
+			cout << "P_" << x + 1 << " at ";
+			game->printPath(n);
+			if (game->getInfoSet(n) != -1)
+				cout << " (information set " << game->getInfoSet(n) << ")";
+			cout << ":";
+			for (int a = 0; a < form.numActions.at(x).at(h); a++)
+			{
+				cout << " s_" << game->getStrategy(actionChildren.at(actionStart.at(n) + a)) + 1 << " " << getAverageProbability(x, h, a);
+				if (a < form.numActions.at(x).at(h) - 1)
+					cout << ",";
+			}
+			cout << endl;
+		}
+}
+
+// current strategy at P_x's information set h from the positive regrets, uniform if there are none
+void MCCFR::regretMatching(int x, int h, double *strategy) const
+{
+	int first = form.firstSequence.at(x).at(h);
+	int k = form.numActions.at(x).at(h);
+	double total = 0.0;
+
+	for (int a = 0; a < k; a++)
+	{
+		strategy[a] = regrets.at(x).at(first + a) > 0.0 ? regrets.at(x).at(first + a) : 0.0;
+		total += strategy[a];
+	}
+	for (int a = 0; a < k; a++)
+		strategy[a] = (total > 0.0) ? strategy[a] / total : 1.0 / k;
+}
+
+/*
+	Runs numIters iterations on numThreads threads (0 for all of them), each task
+	doing roundSize iterations per round before the tables are reduced. The threads
+	are started once and handed every round, so a round costs a wake-up and a
+	reduction. Smaller rounds follow sequential MCCFR more closely, larger ones spend
+	less time reducing. Can be called again to continue.
+*/
+void MCCFR::run(long long numIters, int numThreads, int roundSize, unsigned seed)
+{
+	if (!valid || numIters <= 0)
+		return;
+	if (roundSize < 1)
+		roundSize = 1;
+
+	TaskScheduler scheduler(numThreads);
+	int numTasks = scheduler.getNumThreads();
+	vector<mt19937> generators;
+	vector<vector<vector<double> > > regretDeltas = vector<vector<vector<double> > >(numTasks, regrets);
+	vector<vector<vector<double> > > sumDeltas = vector<vector<vector<double> > >(numTasks, strategySums);
+	vector<vector<double> > scratch = vector<vector<double> >(numTasks, vector<double>(2 * maxDepth * maxActions));
+
+	for (int t = 0; t < numTasks; t++)
+	{
+		generators.push_back(mt19937(seed + t));
+		for (int x = 0; x < 2; x++)
+		{
+			regretDeltas.at(t).at(x).assign(form.numSequences.at(x), 0.0);
+			sumDeltas.at(t).at(x).assign(form.numSequences.at(x), 0.0);
+		}
+	}
+
+	for (long long done = 0; done < numIters; )
+	{
+		long long round = min((long long)roundSize * numTasks, numIters - done);
+
+		function<void(int)> iterate = [&](int t)
+		{
+			long long share = round / numTasks + (t < round % numTasks ? 1 : 0);
+			for (long long i = 0; i < share; i++)
+				for (int traverser = 0; traverser < 2; traverser++)
+				{
+					if (numTasks == 1) // nothing to reduce, so update the shared tables as it goes
+						traverse(0, traverser, generators.at(t), regrets, strategySums, scratch.at(t), 0);
+					else
+						traverse(0, traverser, generators.at(t), regretDeltas.at(t), sumDeltas.at(t), scratch.at(t), 0);
+				}
+		};
+		scheduler.run([&](int w)
+		{
+			for (int t = 1; t < numTasks; t++)
+				scheduler.spawn(w, [&iterate, t](int) { iterate(t); });
+			iterate(0);
+		});
+
+		// reduce the tasks' tables in task order
+		for (int t = 0; t < numTasks; t++)
+			for (int x = 0; x < 2; x++)
+				for (int s = 0; s < form.numSequences.at(x); s++)
+				{
+					regrets.at(x).at(s) += regretDeltas.at(t).at(x).at(s);
+					strategySums.at(x).at(s) += sumDeltas.at(t).at(x).at(s);
+					regretDeltas.at(t).at(x).at(s) = 0.0;
+					sumDeltas.at(t).at(x).at(s) = 0.0;
+				}
+		numIterations += round;
+		done += round;
+	}
+}
+
+/*
+	Sampled counterfactual value of node n for the traverser, in their payoffs. At the
+	traverser's nodes every action is tried and the regrets are updated; at the
+	opponent's nodes the current strategy goes into the strategy sums and one action
+	is sampled from it. scratch holds the strategy and action values at each depth.
+*/
+double MCCFR::traverse(int n, int traverser, mt19937 &generator, vector<vector<double> > &regretDeltas,
+					   vector<vector<double> > &sumDeltas, vector<double> &scratch, int depth) const
+{
+	int k = actionStart.at(n + 1) - actionStart.at(n);
+	if (k == 0)
+		return (traverser == 0) ? leafPayoffs.at(n) : -leafPayoffs.at(n);
+
+	int x = game->getNode(n).getNodePlayer();
+	int h = form.nodeInfoSets.at(n);
+	int first = form.firstSequence.at(x).at(h);
+	double *strategy = &scratch.at(2 * depth * maxActions);
+	double *values = strategy + maxActions;
+
+	regretMatching(x, h, strategy);
+	if (x == traverser)
+	{
+		double value = 0.0;
+		for (int a = 0; a < k; a++)
+		{
+			values[a] = traverse(actionChildren.at(actionStart.at(n) + a), traverser, generator, regretDeltas, sumDeltas, scratch, depth + 1);
+			value += strategy[a] * values[a];
+		}
+		for (int a = 0; a < k; a++)
+			regretDeltas.at(x).at(first + a) += values[a] - value;
+		return value;
+	}
+
+	for (int a = 0; a < k; a++)
+		sumDeltas.at(x).at(first + a) += strategy[a];
+
+	double r = uniform_real_distribution<double>(0.0, 1.0)(generator);
+	int a = 0;
+	while (a < k - 1 && r >= strategy[a])
+	{
+		r -= strategy[a];
+		a++;
+	}
+	return traverse(actionChildren.at(actionStart.at(n) + a), traverser, generator, regretDeltas, sumDeltas, scratch, depth + 1);
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*************************************************
+Title: NodePool.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: slab allocator for the nodes of the
+		 linked structures
+**************************************************/
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+using namespace std;
+
+/*
+	Hands out slots for objects of type N from slabs that grow from 64 slots up to 4096,
+	so filling a game costs a few large allocations instead of one per node. Freed slots
+	go on a free list and are reused first. clear() destroys whatever is still alive and
+	gives the slabs back all at once, which is what a game does when it's destroyed or
+	resized, instead of deleting its lists one at a time.
+*/
+template <typename N>
+class NodePool
+{
+	private:
+		struct Slot
+		{
+			typename aligned_storage<sizeof(N), alignof(N)>::type object; // first, so an N* is a Slot*
+			Slot* nextFree;
+			bool live;
+		};
+
+		vector<Slot*> slabs;
+		vector<int> slabSizes;
+		Slot* freeSlots;
+		int numUsed; // slots handed out from the newest slab
+		int numLive;
+	public:
+		NodePool()
+		{
+			freeSlots = NULL;
+			numUsed = 0;
+			numLive = 0;
+		}
+
+		NodePool(const NodePool &) = delete;
+		NodePool& operator=(const NodePool &) = delete;
+
+		~NodePool()	{ clear(); }
+
+		int getNumLive() const	{ return numLive; }
+		int getNumSlabs() const	{ return slabs.size(); }
+
+		void* allocate();
+		void clear();
+		void deallocate(void*);
+		void destroy(N*);
+
+		// an N made with these constructor arguments
+		template <typename... Args>
+		N* create(Args&&... args)	{ return new (allocate()) N(forward<Args>(args)...); }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// raw space for one N
+template <typename N>
+void* NodePool<N>::allocate()
+{
+	Slot* slot;
+
+	if (freeSlots)
+	{
+		slot = freeSlots;
+		freeSlots = slot->nextFree;
+	}
+	else
+	{
+		if (slabs.empty() || numUsed == slabSizes.back())
+		{
+			int size = slabs.empty() ? 64 : min(slabSizes.back() * 2, 4096);
+			slabs.push_back(new Slot[size]);
+			slabSizes.push_back(size);
+			numUsed = 0;
+		}
+		slot = &slabs.back()[numUsed];
+		numUsed++;
+	}
+	slot->live = true;
+	numLive++;
+	return &slot->object;
+}
+
+// destroys the live objects and frees every slab
+template <typename N>
+void NodePool<N>::clear()
+{
+	for (int b = 0; (unsigned)b < slabs.size(); b++)
+	{
+		int used = ((unsigned)b == slabs.size() - 1) ? numUsed : slabSizes.at(b);
+		for (int k = 0; k < used; k++)
+		{
+			if (slabs.at(b)[k].live)
+				reinterpret_cast<N*>(&slabs.at(b)[k].object)->~N();
+		}
+		delete[] slabs.at(b);
+	}
+	slabs.clear();
+	slabSizes.clear();
+	freeSlots = NULL;
+	numUsed = 0;
+	numLive = 0;
+}
+
+// gives back space from allocate() whose object has already been destroyed
+template <typename N>
+void NodePool<N>::deallocate(void* p)
+{
+	Slot* slot = reinterpret_cast<Slot*>(p);
+	slot->live = false;
+	slot->nextFree = freeSlots;
+	freeSlots = slot;
+	numLive--;
+}
+
+template <typename N>
+void NodePool<N>::destroy(N* n)
+{
+	n->~N();
+	deallocate(n);
+}
+
+#endif
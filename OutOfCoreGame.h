@@ -0,0 +1,692 @@
+/*************************************************
+Title: OutOfCoreGame.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: disk-backed payoffs for games too big
+		 for memory, analyzed a tile at a time
+**************************************************/
+
+#ifndef OUTOFCOREGAME_H
+#define OUTOFCOREGAME_H
+
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+/*
+	Payoffs kept in a file instead of memory. The outcome space is cut into tiles along
+	every player's strategy axis, and a tile holds every player's payoff for each of its
+	outcomes, so it's read and written whole. Tiles on the far edges are padded to full
+	size to keep every tile at a fixed offset. At most cacheBytes of tiles are in memory,
+	in a least-recently-used page cache that writes dirty tiles back when they're
+	evicted, and sweeps ask for the next tile on another thread while they work on the
+	current one.
+
+	Analysis never needs random access to the whole game. computeBestResponses() makes
+	one sweep per player along that player's axis: for each block of the others'
+	strategies it reads the tiles of that line, keeps the best payoff against each of
+	the others' profiles in a file next to the game, and updates which strategies are
+	strictly dominated. computePureEquilibria() then makes one more sweep in file order,
+	comparing each tile with the best payoffs for its lines.
+
+	T is written to the file as raw bytes, so it has to be a plain type such as int or
+	double.
+
+	If the file can't be opened, the constructor says so and isOpen() is false. Every
+	other member then does nothing: getters return 0 or false, and computePureEquilibria()
+	finds no equilibria.
+*/
+template <typename T>
+class OutOfCoreGame
+{
+	static_assert(is_trivially_copyable<T>::value, "out-of-core payoffs have to be plain values");
+
+	private:
+		struct Page
+		{
+			long long tile; // -1 if empty
+			bool dirty;
+			vector<T> data; // local outcome * numPlayers + x
+		};
+
+		int numPlayers;
+		vector<int> numStrats;
+		vector<int> tileStrats; // strategies per tile along each axis
+		vector<int> numTiles; // tiles along each axis
+		long long totalTiles;
+		long long tileOutcomes;
+		string path;
+		fstream file;
+		bool opened;
+		bool analyzed; // best-response files are up to date
+		vector<vector<bool> > dominated;
+
+		vector<Page> pages;
+		list<int> recent; // pages, most recently used first
+		vector<list<int>::iterator> recentPos;
+		unordered_map<long long, int> pageOf;
+		long long hits;
+		long long misses;
+
+		ifstream prefetchFile;
+		future<void> prefetchDone;
+		long long prefetchTile; // -1 if nothing is being prefetched
+		vector<T> prefetchBuffer;
+
+		Page& getPage(long long, bool);
+		long long locate(const vector<int> &, int &) const;
+		void prefetch(long long);
+		void sweepPlayer(int);
+		long long tileIndex(const vector<int> &) const;
+		void writePage(Page &);
+	public:
+		OutOfCoreGame(const vector<int> &, string, long long);
+		~OutOfCoreGame();
+
+		long long getCacheHits() const			{ return hits; }
+		long long getCacheMisses() const		{ return misses; }
+		int getNumPlayers() const				{ return numPlayers; }
+		int getNumStrats(int x) const			{ return numStrats.at(x); }
+		long long getNumTiles() const			{ return totalTiles; }
+		bool isOpen() const						{ return opened; }
+		bool isStrictlyDominated(int x, int s) const	{ return analyzed && dominated.at(x).at(s); }
+
+		void computeBestResponses();
+		long long computePureEquilibria(vector<vector<int> > &, long long);
+		void flush();
+		T getBestResponsePayoff(const vector<int> &, int);
+		T getPayoff(const vector<int> &, int);
+		bool isBestResponse(const vector<int> &, int);
+		void printDominatedStrats();
+		void printPureEquilibria(long long);
+		void randGame();
+		void setPayoff(const vector<int> &, int, T);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+	constructor, a new game with all payoffs 0 stored at path, caching at most cacheBytes
+	of tiles. Tiles are as even as possible across the axes with about an eighth of the
+	cache each, so a sweep has room for the tile it's on and the ones it prefetches.
+*/
+template <typename T>
+OutOfCoreGame<T>::OutOfCoreGame(const vector<int> &nS, string p, long long cacheBytes)
+{
+	numPlayers = nS.size();
+	numStrats = nS;
+	path = p;
+	opened = false;
+	analyzed = false;
+	hits = 0;
+	misses = 0;
+	prefetchTile = -1;
+
+	long long target = max(1LL, cacheBytes / (8LL * numPlayers * (long long)sizeof(T)));
+	tileStrats = vector<int>(numPlayers, 1);
+	tileOutcomes = 1;
+	bool grew = true;
+	while (grew)
+	{
+		// double the smallest axis that still has room
+		grew = false;
+		int smallest = -1;
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (tileStrats.at(x) < numStrats.at(x) && (smallest == -1 || tileStrats.at(x) < tileStrats.at(smallest)))
+				smallest = x;
+		}
+		if (smallest != -1)
+		{
+			int grown = min(numStrats.at(smallest), tileStrats.at(smallest) * 2);
+			if (tileOutcomes / tileStrats.at(smallest) * grown <= target)
+			{
+				tileOutcomes = tileOutcomes / tileStrats.at(smallest) * grown;
+				tileStrats.at(smallest) = grown;
+				grew = true;
+			}
+		}
+	}
+
+	totalTiles = 1;
+	numTiles = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		numTiles.at(x) = (numStrats.at(x) + tileStrats.at(x) - 1) / tileStrats.at(x);
+		totalTiles *= numTiles.at(x);
+	}
+
+	// a sparse file of the full size, so unwritten tiles read back as 0
+	file.open(path, ios::in | ios::out | ios::binary | ios::trunc);
+	long long tileBytes = tileOutcomes * numPlayers * sizeof(T);
+	if (!file)
+	{
+		cout << "ERROR: couldn't open " << path << endl;
+		return;
+	}
+	file.seekp(totalTiles * tileBytes - 1);
+	file.put(0);
+	file.flush();
+	prefetchFile.open(path, ios::in | ios::binary);
+	opened = true;
+
+	int numPages = max(2LL, cacheBytes / tileBytes);
+	pages = vector<Page>(numPages);
+	for (int g = 0; g < numPages; g++)
+	{
+		pages.at(g).tile = -1;
+		pages.at(g).dirty = false;
+		pages.at(g).data = vector<T>(tileOutcomes * numPlayers, T(0));
+		recent.push_back(g);
+	}
+	recentPos = vector<list<int>::iterator>(numPages);
+	for (list<int>::iterator it = recent.begin(); it != recent.end(); it++)
+		recentPos.at(*it) = it;
+	dominated = vector<vector<bool> >(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+		dominated.at(x) = vector<bool>(numStrats.at(x), false);
+}
+
+// writes everything back and removes the best-response files, leaving the game's file
+template <typename T>
+OutOfCoreGame<T>::~OutOfCoreGame()
+{
+	if (!opened)
+		return;
+	if (prefetchDone.valid())
+		prefetchDone.wait();
+	flush();
+	for (int x = 0; x < numPlayers; x++)
+		remove((path + ".br" + to_string(x)).c_str());
+}
+
+/*
+	One sweep per player, leaving P_x's best payoff against each of the others' profiles
+	in path.brx and the strictly dominated strategies in dominated
+*/
+template <typename T>
+void OutOfCoreGame<T>::computeBestResponses()
+{
+	if (!opened)
+		return;
+	for (int x = 0; x < numPlayers; x++)
+		sweepPlayer(x);
+	analyzed = true;
+}
+
+/*
+	Streams the tiles in file order and counts the outcomes where every player's payoff
+	is their best against the others, keeping the first maxStored of them in equilibria.
+	Each tile needs one block of best payoffs per player, read from the files
+	computeBestResponses() wrote.
+*/
+template <typename T>
+long long OutOfCoreGame<T>::computePureEquilibria(vector<vector<int> > &equilibria, long long maxStored)
+{
+	long long count = 0;
+	vector<int> coords = vector<int>(numPlayers, 0); // tile coordinates
+	vector<vector<T> > best = vector<vector<T> >(numPlayers);
+	vector<ifstream> brFiles = vector<ifstream>(numPlayers);
+
+	equilibria.clear();
+	if (!opened)
+		return 0;
+	if (!analyzed)
+		computeBestResponses();
+	for (int x = 0; x < numPlayers; x++)
+	{
+		brFiles.at(x).open(path + ".br" + to_string(x), ios::binary);
+		best.at(x) = vector<T>(tileOutcomes / tileStrats.at(x));
+	}
+
+	for (long long tile = 0; tile < totalTiles; tile++)
+	{
+		if (tile + 1 < totalTiles)
+			prefetch(tile + 1);
+		const vector<T> &data = getPage(tile, false).data;
+
+		// the block of best payoffs for this tile's lines along each axis
+		for (int x = 0; x < numPlayers; x++)
+		{
+			long long slab = 0, stride = 1;
+			for (int y = 0; y < numPlayers; y++)
+			{
+				if (y == x)
+					continue;
+				slab += coords.at(y) * stride;
+				stride *= numTiles.at(y);
+			}
+			brFiles.at(x).seekg(slab * best.at(x).size() * sizeof(T));
+			brFiles.at(x).read(reinterpret_cast<char*>(&best.at(x).at(0)), best.at(x).size() * sizeof(T));
+		}
+
+		vector<int> local = vector<int>(numPlayers, 0);
+		for (long long l = 0; l < tileOutcomes; l++)
+		{
+			bool valid = true, equilibrium = true;
+			for (int x = 0; x < numPlayers && valid; x++)
+				valid = coords.at(x) * tileStrats.at(x) + local.at(x) < numStrats.at(x);
+
+			for (int x = 0; x < numPlayers && valid && equilibrium; x++)
+			{
+				// local index with x's coordinate dropped
+				long long slabLocal = 0, stride = 1;
+				for (int y = 0; y < numPlayers; y++)
+				{
+					if (y == x)
+						continue;
+					slabLocal += local.at(y) * stride;
+					stride *= tileStrats.at(y);
+				}
+				equilibrium = data.at(l * numPlayers + x) == best.at(x).at(slabLocal);
+			}
+			if (valid && equilibrium)
+			{
+				if (count < maxStored)
+				{
+					vector<int> profile = vector<int>(numPlayers);
+					for (int x = 0; x < numPlayers; x++)
+						profile.at(x) = coords.at(x) * tileStrats.at(x) + local.at(x);
+					equilibria.push_back(profile);
+				}
+				count++;
+			}
+
+			for (int x = 0; x < numPlayers && ++local.at(x) == tileStrats.at(x); x++)
+				local.at(x) = 0;
+		}
+
+		for (int x = 0; x < numPlayers && ++coords.at(x) == numTiles.at(x); x++)
+			coords.at(x) = 0;
+	}
+	return count;
+}
+
+// writes every dirty tile back
+template <typename T>
+void OutOfCoreGame<T>::flush()
+{
+	if (!opened)
+		return;
+	for (int g = 0; (unsigned)g < pages.size(); g++)
+	{
+		if (pages.at(g).dirty)
+			writePage(pages.at(g));
+	}
+	file.flush();
+}
+
+// P_x's best payoff against the others' strategies in profile; computeBestResponses() has to have run
+template <typename T>
+T OutOfCoreGame<T>::getBestResponsePayoff(const vector<int> &profile, int x)
+{
+	long long slab = 0, slabLocal = 0, tileStride = 1, localStride = 1;
+	T value = T(0);
+
+	if (!opened)
+		return value;
+	if (!analyzed)
+		computeBestResponses();
+	for (int y = 0; y < numPlayers; y++)
+	{
+		if (y == x)
+			continue;
+		slab += profile.at(y) / tileStrats.at(y) * tileStride;
+		slabLocal += profile.at(y) % tileStrats.at(y) * localStride;
+		tileStride *= numTiles.at(y);
+		localStride *= tileStrats.at(y);
+	}
+
+	ifstream brFile(path + ".br" + to_string(x), ios::binary);
+	brFile.seekg((slab * (tileOutcomes / tileStrats.at(x)) + slabLocal) * sizeof(T));
+	brFile.read(reinterpret_cast<char*>(&value), sizeof(T));
+	return value;
+}
+
+/*
+	The page holding a tile, reading it in if it isn't cached. The least recently used
+	page is written back if it's dirty and then reused.
+*/
+template <typename T>
+typename OutOfCoreGame<T>::Page& OutOfCoreGame<T>::getPage(long long tile, bool write)
+{
+	unordered_map<long long, int>::iterator found = pageOf.find(tile);
+	int g;
+
+	if (found != pageOf.end())
+	{
+		g = found->second;
+		hits++;
+	}
+	else
+	{
+		g = recent.back();
+		Page &page = pages.at(g);
+		if (page.dirty)
+			writePage(page);
+		if (page.tile != -1)
+			pageOf.erase(page.tile);
+
+		long long tileBytes = tileOutcomes * numPlayers * sizeof(T);
+		if (prefetchTile == tile)
+		{
+			prefetchDone.wait();
+			page.data.swap(prefetchBuffer);
+			prefetchTile = -1;
+		}
+		else
+		{
+			file.seekg(tile * tileBytes);
+			file.read(reinterpret_cast<char*>(&page.data.at(0)), tileBytes);
+		}
+		page.tile = tile;
+		pageOf[tile] = g;
+		misses++;
+	}
+
+	recent.erase(recentPos.at(g));
+	recent.push_front(g);
+	recentPos.at(g) = recent.begin();
+	if (write)
+		pages.at(g).dirty = true;
+	return pages.at(g);
+}
+
+template <typename T>
+T OutOfCoreGame<T>::getPayoff(const vector<int> &profile, int x)
+{
+	int l;
+	if (!opened)
+		return T(0);
+	long long tile = locate(profile, l);
+	return getPage(tile, false).data.at(l * numPlayers + x);
+}
+
+template <typename T>
+bool OutOfCoreGame<T>::isBestResponse(const vector<int> &profile, int x)
+{
+	if (!opened)
+		return false;
+	return getPayoff(profile, x) == getBestResponsePayoff(profile, x);
+}
+
+// tile of a profile, and its outcome's index l within the tile
+template <typename T>
+long long OutOfCoreGame<T>::locate(const vector<int> &profile, int &l) const
+{
+	vector<int> coords = vector<int>(numPlayers);
+	int stride = 1;
+
+	l = 0;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		coords.at(x) = profile.at(x) / tileStrats.at(x);
+		l += profile.at(x) % tileStrats.at(x) * stride;
+		stride *= tileStrats.at(x);
+	}
+	return tileIndex(coords);
+}
+
+/*
+	Starts reading a tile on another thread, unless it's cached or already coming.
+	Only one tile is prefetched at a time.
+*/
+template <typename T>
+void OutOfCoreGame<T>::prefetch(long long tile)
+{
+	if (pageOf.count(tile) || prefetchTile == tile)
+		return;
+	if (prefetchDone.valid())
+		prefetchDone.wait();
+
+	long long tileBytes = tileOutcomes * numPlayers * sizeof(T);
+	prefetchBuffer.resize(tileOutcomes * numPlayers);
+	prefetchTile = tile;
+	prefetchDone = async(launch::async, [this, tile, tileBytes]()
+	{
+		prefetchFile.clear();
+		prefetchFile.seekg(tile * tileBytes);
+		prefetchFile.read(reinterpret_cast<char*>(&prefetchBuffer.at(0)), tileBytes);
+	});
+}
+
+/*
+	Strictly Dominated Strategies:
+	P_1: s_3
+	P_2: none
+*/
+template <typename T>
+void OutOfCoreGame<T>::printDominatedStrats()
+{
+	if (!opened)
+		return;
+	if (!analyzed)
+		computeBestResponses();
+	cout << "\nStrictly Dominated Strategies:\n";
+	for (int x = 0; x < numPlayers; x++)
+	{
+		bool any = false;
+		cout << "P_" << x + 1 << ":";
+		for (int s = 0; s < numStrats.at(x); s++)
+		{
+			if (dominated.at(x).at(s))
+			{
+				cout << " s_" << s + 1;
+				any = true;
+			}
+		}
+		if (!any)
+			cout << " none";
+		cout << endl;
+	}
+}
+
+/*
+	Pure Equilibria (3, showing 2):
+	(s_1, s_4, s_2)
+	...
+*/
+template <typename T>
+void OutOfCoreGame<T>::printPureEquilibria(long long maxShown)
+{
+	vector<vector<int> > equilibria;
+	if (!opened)
+		return;
+	long long count = computePureEquilibria(equilibria, maxShown);
+
+	cout << "\nPure Equilibria (" << count << ", showing " << equilibria.size() << "):\n";
+	for (int e = 0; (unsigned)e < equilibria.size(); e++)
+	{
+		cout << "(";
+		for (int x = 0; x < numPlayers; x++)
+		{
+			cout << "s_" << equilibria.at(e).at(x) + 1;
+			if (x < numPlayers - 1)
+				cout << ", ";
+		}
+		cout << ")\n";
+	}
+}
+
+// payoffs from 0 to 99, like simGame::randGame(), written a tile at a time
+template <typename T>
+void OutOfCoreGame<T>::randGame()
+{
+	if (!opened)
+		return;
+	for (long long tile = 0; tile < totalTiles; tile++)
+	{
+		vector<T> &data = getPage(tile, true).data;
+		for (int i = 0; (unsigned)i < data.size(); i++)
+			data.at(i) = rand() % 100;
+	}
+	flush();
+	analyzed = false;
+}
+
+template <typename T>
+void OutOfCoreGame<T>::setPayoff(const vector<int> &profile, int x, T value)
+{
+	int l;
+	if (!opened)
+		return;
+	long long tile = locate(profile, l);
+	getPage(tile, true).data.at(l * numPlayers + x) = value;
+	analyzed = false;
+}
+
+/*
+	P_x's sweep. The others' tile coordinates pick a block of lines along x's axis; the
+	tiles of that block are read in order, copying P_x's payoffs into a buffer of whole
+	lines. Then the best payoff on each line goes to P_x's best-response file, and each
+	pair of strategies is checked for strict dominance on these lines.
+*/
+template <typename T>
+void OutOfCoreGame<T>::sweepPlayer(int x)
+{
+	long long slabSize = tileOutcomes / tileStrats.at(x);
+	vector<T> lines = vector<T>(numStrats.at(x) * slabSize);
+	vector<T> maxima = vector<T>(slabSize);
+	vector<bool> slabValid = vector<bool>(slabSize);
+	vector<vector<bool> > dominates = vector<vector<bool> >(numStrats.at(x), vector<bool>(numStrats.at(x), true)); // dominates.at(a).at(b): a > b so far
+	vector<int> coords = vector<int>(numPlayers, 0);
+	ofstream brFile(path + ".br" + to_string(x), ios::binary | ios::trunc);
+
+	flush();
+	while (true)
+	{
+		// which of the block's lines really exist at the edges
+		vector<int> local = vector<int>(numPlayers, 0);
+		for (long long k = 0; k < slabSize; k++)
+		{
+			bool valid = true;
+			for (int y = 0; y < numPlayers; y++)
+			{
+				if (y != x && coords.at(y) * tileStrats.at(y) + local.at(y) >= numStrats.at(y))
+					valid = false;
+			}
+			slabValid.at(k) = valid;
+			for (int y = 0; y < numPlayers; y++)
+			{
+				if (y == x)
+					continue;
+				if (++local.at(y) < tileStrats.at(y))
+					break;
+				local.at(y) = 0;
+			}
+		}
+
+		for (int t = 0; t < numTiles.at(x); t++)
+		{
+			coords.at(x) = t;
+			long long tile = tileIndex(coords);
+			if (t + 1 < numTiles.at(x))
+			{
+				coords.at(x) = t + 1;
+				prefetch(tileIndex(coords));
+				coords.at(x) = t;
+			}
+			const vector<T> &data = getPage(tile, false).data;
+
+			// local index l = lx + tileStrats_x * (index of the rest) when x is first, otherwise split around x
+			long long below = 1;
+			for (int y = 0; y < x; y++)
+				below *= tileStrats.at(y);
+			for (long long l = 0; l < tileOutcomes; l++)
+			{
+				int lx = (l / below) % tileStrats.at(x);
+				int s = t * tileStrats.at(x) + lx;
+				if (s >= numStrats.at(x))
+					continue;
+				long long k = l % below + (l / below / tileStrats.at(x)) * below;
+				lines.at(s * slabSize + k) = data.at(l * numPlayers + x);
+			}
+		}
+
+		for (long long k = 0; k < slabSize; k++)
+		{
+			if (!slabValid.at(k))
+			{
+				maxima.at(k) = T(0);
+				continue;
+			}
+			maxima.at(k) = lines.at(k);
+			for (int s = 1; s < numStrats.at(x); s++)
+			{
+				if (lines.at(s * slabSize + k) > maxima.at(k))
+					maxima.at(k) = lines.at(s * slabSize + k);
+			}
+		}
+		brFile.write(reinterpret_cast<const char*>(&maxima.at(0)), slabSize * sizeof(T));
+
+		for (int a = 0; a < numStrats.at(x); a++)
+			for (int b = 0; b < numStrats.at(x); b++)
+			{
+				if (a == b || !dominates.at(a).at(b))
+					continue;
+				for (long long k = 0; k < slabSize; k++)
+				{
+					if (slabValid.at(k) && !(lines.at(a * slabSize + k) > lines.at(b * slabSize + k)))
+					{
+						dominates.at(a).at(b) = false;
+						break;
+					}
+				}
+			}
+
+		// next block, skipping x's axis
+		coords.at(x) = 0;
+		int y = 0;
+		while (y < numPlayers && (y == x || coords.at(y) == numTiles.at(y) - 1))
+		{
+			if (y != x)
+				coords.at(y) = 0;
+			y++;
+		}
+		if (y == numPlayers)
+			break;
+		coords.at(y)++;
+	}
+
+	for (int b = 0; b < numStrats.at(x); b++)
+	{
+		dominated.at(x).at(b) = false;
+		for (int a = 0; a < numStrats.at(x); a++)
+		{
+			if (a != b && dominates.at(a).at(b))
+				dominated.at(x).at(b) = true;
+		}
+	}
+}
+
+template <typename T>
+long long OutOfCoreGame<T>::tileIndex(const vector<int> &coords) const
+{
+	long long tile = 0, stride = 1;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		tile += coords.at(x) * stride;
+		stride *= numTiles.at(x);
+	}
+	return tile;
+}
+
+template <typename T>
+void OutOfCoreGame<T>::writePage(Page &page)
+{
+	long long tileBytes = tileOutcomes * numPlayers * sizeof(T);
+	file.seekp(page.tile * tileBytes);
+	file.write(reinterpret_cast<const char*>(&page.data.at(0)), tileBytes);
+	file.flush();
+	page.dirty = false;
+}
+
+#endif
@@ -0,0 +1,167 @@
+/*******************************
+Title: Rational.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: exact fractions for LP's
+********************************/
+
+#ifndef RATIONAL_H
+#define RATIONAL_H
+
+#include "BigInt.h"
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+// fractions of the form numerator / denominator, always stored in lowest terms with denominator > 0
+class Rational
+{
+	private:
+		BigInt numerator;
+		BigInt denominator;
+
+		Rational(const BigInt &, const BigInt &);
+
+		void normalize();
+	public:
+		Rational()							{ numerator = 0; denominator = 1; }
+		Rational(long long n)				{ numerator = n; denominator = 1; }
+		Rational(long long, long long);
+
+		const BigInt& getNumerator() const		{ return numerator; }
+		const BigInt& getDenominator() const	{ return denominator; }
+		double toDouble() const;
+		explicit operator double() const		{ return toDouble(); }
+
+		Rational operator+(const Rational &r) const;
+		Rational operator-(const Rational &r) const;
+		Rational operator*(const Rational &r) const;
+		Rational operator/(const Rational &r) const;
+		Rational operator-() const;
+		Rational& operator+=(const Rational &r)		{ *this = *this + r; return *this; }
+		Rational& operator-=(const Rational &r)		{ *this = *this - r; return *this; }
+		Rational& operator*=(const Rational &r)		{ *this = *this * r; return *this; }
+		Rational& operator/=(const Rational &r)		{ *this = *this / r; return *this; }
+		bool operator==(const Rational &r) const	{ return numerator == r.numerator && denominator == r.denominator; }
+		bool operator!=(const Rational &r) const	{ return !(*this == r); }
+		bool operator<(const Rational &r) const		{ return numerator * r.denominator < r.numerator * denominator; }
+		bool operator>(const Rational &r) const		{ return r < *this; }
+		bool operator<=(const Rational &r) const	{ return !(r < *this); }
+		bool operator>=(const Rational &r) const	{ return !(*this < r); }
+
+		friend ostream& operator << (ostream& os, const Rational& r)
+		{
+			os << r.numerator;
+			if (r.denominator != BigInt(1))
+				os << "/" << r.denominator;
+			return os;
+		}
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructors
+Rational::Rational(long long n, long long d)
+{
+	numerator = n;
+	denominator = d;
+	if (denominator.isZero())
+	{
+		cout << "ERROR: denominator of 0, using 1\n";
+		denominator = 1;
+	}
+	normalize();
+}
+
+Rational::Rational(const BigInt &n, const BigInt &d)
+{
+	numerator = n;
+	denominator = d;
+	normalize();
+}
+
+// reduce to lowest terms and keep the sign in the numerator
+void Rational::normalize()
+{
+	if (denominator.isNegative())
+	{
+		numerator = -numerator;
+		denominator = -denominator;
+	}
+	BigInt g = BigInt::gcd(numerator, denominator);
+	if (g > BigInt(1))
+	{
+		numerator = numerator / g;
+		denominator = denominator / g;
+	}
+}
+
+Rational Rational::operator+(const Rational &r) const
+{
+	// divide by the gcd of the denominators first to keep intermediate values small
+	BigInt g = BigInt::gcd(denominator, r.denominator);
+	if (g == BigInt(1))
+		return Rational(numerator * r.denominator + r.numerator * denominator, denominator * r.denominator);
+	return Rational(numerator * (r.denominator / g) + r.numerator * (denominator / g), (denominator / g) * r.denominator);
+}
+
+Rational Rational::operator-(const Rational &r) const
+{
+	return *this + (-r);
+}
+
+Rational Rational::operator*(const Rational &r) const
+{
+	if (numerator.isZero() || r.numerator.isZero())
+		return Rational(0);
+
+	// cross-cancel before multiplying
+	BigInt g1 = BigInt::gcd(numerator, r.denominator);
+	BigInt g2 = BigInt::gcd(r.numerator, denominator);
+	Rational product;
+	product.numerator = (numerator / g1) * (r.numerator / g2);
+	product.denominator = (denominator / g2) * (r.denominator / g1);
+	return product;
+}
+
+Rational Rational::operator/(const Rational &r) const
+{
+	if (r.numerator.isZero())
+	{
+		cout << "ERROR: division by 0\n";
+		return Rational(0);
+	}
+
+	// cross-cancel, then keep the sign in the numerator
+	BigInt g1 = BigInt::gcd(numerator, r.numerator);
+	BigInt g2 = BigInt::gcd(denominator, r.denominator);
+	Rational quotient;
+	quotient.numerator = (numerator / g1) * (r.denominator / g2);
+	quotient.denominator = (denominator / g2) * (r.numerator / g1);
+	if (quotient.denominator.isNegative())
+	{
+		quotient.numerator = -quotient.numerator;
+		quotient.denominator = -quotient.denominator;
+	}
+	return quotient;
+}
+
+Rational Rational::operator-() const
+{
+	Rational r;
+	r.numerator = -numerator;
+	r.denominator = denominator;
+	return r;
+}
+
+// the leading digits of each part, so huge numerators and denominators don't overflow the double
+double Rational::toDouble() const
+{
+	int numeratorExponent, denominatorExponent;
+	double n = numerator.toDouble(numeratorExponent);
+	double d = denominator.toDouble(denominatorExponent);
+	return ldexp(n / d, numeratorExponent - denominatorExponent);
+}
+
+#endif
@@ -0,0 +1,268 @@
+/*************************************************
+Title: RepeatedGame.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: finitely repeated two-player games
+		 between automata, and tournaments
+**************************************************/
+
+#ifndef REPEATEDGAME_H
+#define REPEATEDGAME_H
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include "Automaton.h"
+#include "SimGame.h"
+#include "TaskScheduler.h"
+
+/*
+	A two-player simGame played numRounds times, with round t's payoffs weighted by
+	discount^t. The stage payoffs are copied when the RepeatedGame is made, so later
+	edits to the stage game need a new RepeatedGame.
+
+	Two automata playing each other are deterministic, so once a pair of states comes
+	back, play cycles. A match only walks up to the first repeated pair, finds how much
+	weight each outcome gets over all numRounds rounds from the geometric series of the
+	cycle, and takes both players' totals as dot products of those weights with the
+	stage payoffs. A match costs at most the product of the numbers of states, however
+	many rounds there are.
+*/
+template <typename T>
+class RepeatedGame
+{
+	private:
+		int numStrats0; // P_1's strategies in the stage game
+		int numStrats1;
+		vector<double> stagePayoffs; // both players' payoffs for outcome i + numStrats0 * j
+		int numRounds;
+		double discount;
+		bool pd;
+		bool sh;
+
+		// reused between matches so nothing is allocated per match
+		struct Scratch
+		{
+			vector<int> visited; // round each pair of states was first reached, -1 if not yet
+			vector<int> keys; // pairs of states in the order they were reached
+			vector<int> outcomes; // outcome of each round up to the cycle
+			vector<double> weights; // total discount weight of each outcome
+		};
+
+		void playMatch(const Automaton &, const Automaton &, Scratch &, double *) const;
+	public:
+		RepeatedGame(simGame<T>*, int, double);
+
+		double getDiscount() const	{ return discount; }
+		int getNumRounds() const	{ return numRounds; }
+
+		bool canPlay(const Automaton &, const Automaton &) const;
+		vector<double> play(const Automaton &, const Automaton &) const;
+		void printTournament(const vector<Automaton> &, int) const;
+		vector<double> tournament(const vector<Automaton> &, int) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, stage has to have 2 players
+template <typename T>
+RepeatedGame<T>::RepeatedGame(simGame<T>* stage, int rounds, double delta)
+{
+	numRounds = rounds;
+	discount = delta;
+	numStrats0 = 0;
+	numStrats1 = 0;
+	pd = false;
+	sh = false;
+	if (stage->getNumPlayers() != 2)
+	{
+		cout << "ERROR: repeated games need a stage game with 2 players\n";
+		return;
+	}
+
+	GameFeatures<T> features = stage->computeFeatures();
+	numStrats0 = features.getNumStrats(0);
+	numStrats1 = features.getNumStrats(1);
+	stagePayoffs = vector<double>(features.getNumOutcomes() * 2);
+	for (int o = 0; o < features.getNumOutcomes(); o++)
+		for (int x = 0; x < 2; x++)
+			stagePayoffs.at(o * 2 + x) = static_cast<double>(features.getPayoff(o, x));
+	pd = features.isPD();
+	sh = features.isSH();
+}
+
+// a plays P_1's strategies reacting to P_2's, and b the other way around
+template <typename T>
+bool RepeatedGame<T>::canPlay(const Automaton &a, const Automaton &b) const
+{
+	if (!a.isValid() || !b.isValid() || a.getNumOpponentStrats() != numStrats1 || b.getNumOpponentStrats() != numStrats0)
+		return false;
+	for (int q = 0; q < a.getNumStates(); q++)
+	{
+		if (a.getAction(q) >= numStrats0)
+			return false;
+	}
+	for (int q = 0; q < b.getNumStates(); q++)
+	{
+		if (b.getAction(q) >= numStrats1)
+			return false;
+	}
+	return true;
+}
+
+// discounted totals of a as P_1 and b as P_2, empty if they can't play this game
+template <typename T>
+vector<double> RepeatedGame<T>::play(const Automaton &a, const Automaton &b) const
+{
+	Scratch scratch;
+	vector<double> totals = vector<double>(2, 0.0);
+
+	if (!canPlay(a, b))
+	{
+		cout << "ERROR: " << a.getName() << " and " << b.getName() << " can't play this game\n";
+		return vector<double>();
+	}
+	playMatch(a, b, scratch, &totals.at(0));
+	return totals;
+}
+
+template <typename T>
+void RepeatedGame<T>::playMatch(const Automaton &a, const Automaton &b, Scratch &scratch, double *totals) const
+{
+	int numStatesB = b.getNumStates();
+	int numOutcomes = numStrats0 * numStrats1;
+	int qa = a.getStart();
+	int qb = b.getStart();
+	double w = 1.0; // discount^t
+
+	if ((int)scratch.visited.size() < a.getNumStates() * numStatesB)
+		scratch.visited.resize(a.getNumStates() * numStatesB, -1);
+	scratch.keys.clear();
+	scratch.outcomes.clear();
+	scratch.weights.assign(numOutcomes, 0.0);
+
+	for (int t = 0; t < numRounds; t++)
+	{
+		int key = qa * numStatesB + qb;
+		if (scratch.visited.at(key) != -1)
+		{
+			// rounds t, t + 1, ... repeat rounds c, ..., t - 1
+			int c = scratch.visited.at(key);
+			int length = t - c;
+			int remaining = numRounds - t;
+			int full = remaining / length;
+			double cycleDiscount = pow(discount, length);
+			double lastDiscount = pow(cycleDiscount, full);
+			double series = (cycleDiscount == 1.0) ? full : (1.0 - lastDiscount) / (1.0 - cycleDiscount);
+
+			for (int k = 0; k < length; k++)
+			{
+				scratch.weights.at(scratch.outcomes.at(c + k)) += w * (series + (k < remaining % length ? lastDiscount : 0.0));
+				w *= discount;
+			}
+			break;
+		}
+		scratch.visited.at(key) = t;
+		scratch.keys.push_back(key);
+
+		int i = a.getAction(qa);
+		int j = b.getAction(qb);
+		scratch.outcomes.push_back(i + numStrats0 * j);
+		scratch.weights.at(i + numStrats0 * j) += w;
+		w *= discount;
+		qa = a.getNext(qa, j);
+		qb = b.getNext(qb, i);
+	}
+
+	for (int k = 0; (unsigned)k < scratch.keys.size(); k++)
+		scratch.visited.at(scratch.keys.at(k)) = -1;
+
+	totals[0] = 0.0;
+	totals[1] = 0.0;
+	for (int o = 0; o < numOutcomes; o++)
+	{
+		totals[0] += scratch.weights.at(o) * stagePayoffs.at(o * 2);
+		totals[1] += scratch.weights.at(o) * stagePayoffs.at(o * 2 + 1);
+	}
+}
+
+/*
+	TOURNAMENT: 3 automata, 200 rounds, discount 0.99 (PD)
+	 1. TFT            1234.5
+	 ...
+*/
+template <typename T>
+void RepeatedGame<T>::printTournament(const vector<Automaton> &automata, int numThreads) const
+{
+	int n = automata.size();
+	vector<double> scores = tournament(automata, numThreads);
+	vector<double> totals = vector<double>(n, 0.0);
+	vector<int> order = vector<int>(n);
+
+	if (scores.empty())
+		return;
+	for (int i = 0; i < n; i++)
+	{
+		order.at(i) = i;
+		for (int j = 0; j < n; j++)
+			totals.at(i) += scores.at(i * n + j);
+	}
+	stable_sort(order.begin(), order.end(), [&totals](int p, int q) { return totals.at(p) > totals.at(q); });
+
+	cout << "\nTOURNAMENT: " << n << " automata, " << numRounds << " rounds, discount " << discount;
+	if (pd)
+		cout << " (PD)";
+	else if (sh)
+		cout << " (SH)";
+	cout << "\n--------------------------\n";
+	for (int r = 0; r < n; r++)
+		cout << setw(3) << r + 1 << ". " << left << setw(15) << automata.at(order.at(r)).getName() << right << totals.at(order.at(r)) << endl;
+}
+
+/*
+	Round robin, each automaton also playing a copy of itself. Entry i * n + j is what
+	automaton i gets against j, playing P_1 if i <= j and P_2 otherwise. Rows are spread
+	over numThreads threads (0 for all of them); each match writes its own two entries.
+	Empty if some pair can't play this game.
+*/
+template <typename T>
+vector<double> RepeatedGame<T>::tournament(const vector<Automaton> &automata, int numThreads) const
+{
+	int n = automata.size();
+	vector<double> scores = vector<double>(n * n, 0.0);
+
+	for (int i = 0; i < n; i++)
+	{
+		if (!canPlay(automata.at(i), automata.at(i)))
+		{
+			cout << "ERROR: " << automata.at(i).getName() << " can't play this game\n";
+			return vector<double>();
+		}
+	}
+	if (numStrats0 != numStrats1 && n > 1)
+	{
+		cout << "ERROR: tournaments need both players to have the same strategies\n";
+		return vector<double>();
+	}
+
+	TaskScheduler scheduler(numThreads);
+	vector<Scratch> scratch = vector<Scratch>(scheduler.getNumThreads());
+	scheduler.run([&](int w)
+	{
+		for (int i = 0; i < n; i++)
+			scheduler.spawn(w, [&, i](int worker)
+			{
+				double totals[2];
+				for (int j = i; j < n; j++)
+				{
+					playMatch(automata.at(i), automata.at(j), scratch.at(worker), totals);
+					scores.at(i * n + j) = totals[0];
+					if (j != i)
+						scores.at(j * n + i) = totals[1];
+				}
+			});
+	});
+	return scores;
+}
+
+#endif
@@ -0,0 +1,270 @@
+/*************************************************
+Title: ResultWriter.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: buffered JSON-lines/CSV records for
+		 analysis results
+**************************************************/
+
+#ifndef RESULTWRITER_H
+#define RESULTWRITER_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+/*
+	A record is a type and a list of named fields:
+
+		writer.beginRecord("equilibrium");
+		writer.addField("profile", profile);
+		writer.addField("paretoOptimal", true);
+		writer.endRecord();
+
+	JSON lines: {"record":"equilibrium","profile":[0,1],"paretoOptimal":true}
+	CSV: a header line whenever the field names change, then the row.
+	Lists are space-separated in CSV, and strings with commas or quotes are quoted.
+
+	Numbers are formatted with snprintf straight into a buffer that's written out once
+	it passes bufferSize, so a batch of results costs a few large writes and no setw
+	layout.
+*/
+class ResultWriter
+{
+	private:
+		ostream* out;
+		bool csv;
+		int bufferSize;
+		string buffer;
+
+		// the record being built
+		string type;
+		vector<string> names;
+		vector<string> values;
+		string lastHeader; // CSV header in use
+
+		void addValue(const string &, const string &);
+		static void appendNumber(string &, double);
+		static void appendNumber(string &, long long);
+		static string quote(const string &, bool);
+	public:
+		ResultWriter(ostream &o, bool c = false, int size = 1 << 16)
+		{
+			out = &o;
+			csv = c;
+			bufferSize = size;
+			buffer.reserve(size + 1024);
+		}
+
+		ResultWriter(const ResultWriter &) = delete;
+		ResultWriter& operator=(const ResultWriter &) = delete;
+
+		~ResultWriter()	{ flush(); }
+
+		void addField(const string &, bool);
+		void addField(const string &, double);
+		void addField(const string &, int);
+		void addField(const string &, long long);
+		void addField(const string &, const string &);
+		void addField(const string &, const char*);
+		void addField(const string &, const vector<int> &);
+		void addField(const string &, const vector<double> &);
+		void beginRecord(const string &);
+		void endRecord();
+		void flush();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ResultWriter::addField(const string &name, bool val)
+{
+	addValue(name, val ? "true" : "false");
+}
+
+void ResultWriter::addField(const string &name, double val)
+{
+	string str;
+	appendNumber(str, val);
+	addValue(name, str);
+}
+
+void ResultWriter::addField(const string &name, int val)
+{
+	addField(name, (long long)val);
+}
+
+void ResultWriter::addField(const string &name, long long val)
+{
+	string str;
+	appendNumber(str, val);
+	addValue(name, str);
+}
+
+void ResultWriter::addField(const string &name, const string &val)
+{
+	addValue(name, quote(val, csv));
+}
+
+void ResultWriter::addField(const string &name, const char* val)
+{
+	addField(name, string(val));
+}
+
+void ResultWriter::addField(const string &name, const vector<int> &val)
+{
+	string str = csv ? "" : "[";
+	for (int n = 0; (unsigned)n < val.size(); n++)
+	{
+		if (n > 0)
+			str += csv ? " " : ",";
+		appendNumber(str, (long long)val.at(n));
+	}
+	if (!csv)
+		str += "]";
+	addValue(name, str);
+}
+
+void ResultWriter::addField(const string &name, const vector<double> &val)
+{
+	string str = csv ? "" : "[";
+	for (int n = 0; (unsigned)n < val.size(); n++)
+	{
+		if (n > 0)
+			str += csv ? " " : ",";
+		appendNumber(str, val.at(n));
+	}
+	if (!csv)
+		str += "]";
+	addValue(name, str);
+}
+
+// values are already formatted for the output
+void ResultWriter::addValue(const string &name, const string &val)
+{
+	names.push_back(name);
+	values.push_back(val);
+}
+
+// 15 digits unless it takes 17 to read back as the same double, null if it isn't finite
+void ResultWriter::appendNumber(string &str, double val)
+{
+	char digits[32];
+
+	if (val != val || val > 1.7976931348623157e308 || val < -1.7976931348623157e308)
+	{
+		str += "null";
+		return;
+	}
+	snprintf(digits, sizeof(digits), "%.15g", val);
+	if (strtod(digits, NULL) != val)
+		snprintf(digits, sizeof(digits), "%.17g", val);
+	str += digits;
+}
+
+void ResultWriter::appendNumber(string &str, long long val)
+{
+	char digits[24];
+	snprintf(digits, sizeof(digits), "%lld", val);
+	str += digits;
+}
+
+void ResultWriter::beginRecord(const string &t)
+{
+	type = t;
+	names.clear();
+	values.clear();
+}
+
+void ResultWriter::endRecord()
+{
+	if (csv)
+	{
+		string header = "record";
+		for (int n = 0; (unsigned)n < names.size(); n++)
+			header += "," + names.at(n);
+		if (header != lastHeader)
+		{
+			buffer += header + "\n";
+			lastHeader = header;
+		}
+		buffer += quote(type, true);
+		for (int n = 0; (unsigned)n < values.size(); n++)
+			buffer += "," + values.at(n);
+		buffer += "\n";
+	}
+	else
+	{
+		buffer += "{\"record\":" + quote(type, false);
+		for (int n = 0; (unsigned)n < names.size(); n++)
+			buffer += "," + quote(names.at(n), false) + ":" + values.at(n);
+		buffer += "}\n";
+	}
+
+	if ((int)buffer.size() >= bufferSize)
+		flush();
+}
+
+void ResultWriter::flush()
+{
+	if (!buffer.empty())
+	{
+		out->write(buffer.data(), buffer.size());
+		buffer.clear();
+	}
+	out->flush();
+}
+
+/*
+	A JSON string, or a CSV cell that's only quoted if it has to be. JSON can't have raw
+	control characters, so every one below 0x20 is escaped, as \uXXXX if it has no
+	short form.
+*/
+string ResultWriter::quote(const string &str, bool forCSV)
+{
+	string quoted = "\"";
+	bool needsQuotes = !forCSV;
+
+	for (int n = 0; (unsigned)n < str.size(); n++)
+	{
+		char c = str.at(n);
+		if (forCSV)
+		{
+			if (c == ',' || c == '"' || c == '\n' || c == '\r')
+				needsQuotes = true;
+			if (c == '"')
+				quoted += '"';
+			quoted += c;
+		}
+		else if (c == '"' || c == '\\')
+		{
+			quoted += '\\';
+			quoted += c;
+		}
+		else if (c == '\n')
+			quoted += "\\n";
+		else if (c == '\r')
+			quoted += "\\r";
+		else if (c == '\t')
+			quoted += "\\t";
+		else if (c == '\b')
+			quoted += "\\b";
+		else if (c == '\f')
+			quoted += "\\f";
+		else if ((unsigned char)c < 0x20)
+		{
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+			quoted += escaped;
+		}
+		else
+			quoted += c;
+	}
+	if (!needsQuotes)
+		return str;
+	return quoted + "\"";
+}
+
+#endif
@@ -8,231 +8,793 @@ Purpose: class for sequential aspects of games
 #ifndef SEQGAME_H
 #define SEQGAME_H
 #include "Player.h"
+#include "SimGame.h"
 #include "TreeNode.h"
+#include "TaskScheduler.h"
 
-// WIP, search tree of payoffs
+/*
+	Sequence form of a two-player game. Each player's sequences are numbered from 0, the
+	empty sequence. The sequences of P_x's information set h are the
+	numActions.at(x).at(h) consecutive ones from firstSequence.at(x).at(h), one per
+	action, and h is reached by parentSequence.at(x).at(h). Each leaf is recorded with
+	the pair of sequences reaching it, so the form is linear in the size of the tree.
+*/
+struct SequenceForm
+{
+	vector<int> numSequences;
+	vector<vector<int> > firstSequence;
+	vector<vector<int> > numActions;
+	vector<vector<int> > parentSequence;
+	vector<vector<int> > infoSetNodes; // a node in each information set
+	vector<int> nodeInfoSets; // information set of each node, -1 at leaves and placeholders
+	vector<vector<int> > leafSequences; // P_1's and P_2's sequences for each leaf
+	vector<vector<int> > leafPayoffs;
+};
+
+/*
+	Search tree of payoffs stored as a flat array of TreeNodes with the root at 0.
+	A node at level l is where P_{l % numPlayers} moves unless set otherwise; its
+	i-th branch is the node reached by playing s_i. Leaves hold the payoffs.
+	computeSubgamePerfect() finds the subgame-perfect equilibrium by backward
+	induction.
+
+	Every node comes after its parent in the array, so a reverse sweep visits branches
+	before the nodes above them. When insert() has to move a node's branches to make
+	room, that order is lost and the array is repacked breadth-first before the next
+	traversal, which changes node indices.
+
+	Nodes can be grouped into information sets with setInfoSet(), which makes the game
+	one of imperfect information. Backward induction ignores them; the sequence form
+	and computeSequenceFormSolution() take them into account. The reduced strategies,
+	the reduced normal form and printSubgamePerfect() treat every node as its own
+	information set, so they refuse trees where one has more than one node.
+*/
 class SeqGame
 {
 	private:
-		TreeNode* root;
-		int numNodes;
+		vector<TreeNode> nodes;
+		vector<int> payoffPool; // numPlayers payoffs for each leaf with payoffs
+		vector<int> values; // numPlayers values for each node, from computeSubgamePerfect()
+		vector<long long> numReduced; // numPlayers counts for each node, from computeReducedStrategyCounts()
+		int numNodes; // not counting placeholders or moved-from slots
 		int numPlayers;
 		vector<Player*> players; // array of pointers to Players
-		
-		void insert(TreeNode*&, TreeNode* &);
-		void destroySubTree(TreeNode*);
-		void displayInOrder(TreeNode*) const;
-		// void displayPreOrder(TreeNode*) const;
-		void displayPostOrder(TreeNode*) const;
+		bool ordered; // every node comes after its parent
+		bool solved;
+
+		int addNode(int, int);
+		bool computeReducedStrategyCounts();
+		void displayInOrder(int) const;
+		void displayPostOrder(int) const;
+		void evaluateNode(int);
+		int findSharedInfoSet() const;
+		void growBranches(int, int);
+		void solveSubtree(int, vector<int> &);
+		void pack();
 	public:
 		SeqGame()
 		{
-			root = new TreeNode;
-			root = NULL;
 			numNodes = 0;
 			numPlayers = 2;
-			players = vector<Player*>(numPlayers);
+			ordered = true;
+			solved = false;
+			for (int x = 0; x < numPlayers; x++)
+				players.push_back(new Player(numPlayers, x));
 		}
-		
+
 		SeqGame(int nP)
 		{
-			root = new TreeNode;
-			root = NULL;
 			numNodes = 0;
 			numPlayers = nP;
-			players = vector<Player*>(numPlayers);
-		}
-		
-		~SeqGame()
-		{ destroySubTree(root); }
-		
-		void displayPreOrder(TreeNode*) const;
-		
+			ordered = true;
+			solved = false;
+			for (int x = 0; x < numPlayers; x++)
+				players.push_back(new Player(numPlayers, x));
+		}
+
+		void displayPreOrder(int) const;
+
+		int getChoice(int n) const
+		{ return nodes.at(n).getChoice(); }
+
+		int getInfoSet(int n) const
+		{ return nodes.at(n).getInfoSet(); }
+
+		const TreeNode& getNode(int n) const
+		{ return nodes.at(n); }
+
+		int getNumNodes() const
+		{ return numNodes; }
+
+		int getNumPlayers() const
+		{ return numPlayers; }
+
 		Player* getPlayer(int i) const
 		{ return players.at(i); }
-		
-		TreeNode* getRoot()
-		{ return root; }
-		
-		void setRoot(TreeNode* node)
-		{ root = node; }
-		
-		void computePath(TreeNode*);
-		int difference(TreeNode*);
-		void display(TreeNode* , int);
-		int height(TreeNode*);
-		void insert(TreeNode*, vector<int>);
+
+		// index of the root, -1 if the tree is empty
+		int getRoot() const
+		{ return nodes.empty() ? -1 : 0; }
+
+		int getValue(int n, int x) const
+		{ return values.at(n * numPlayers + x); }
+
+		// 0 if an information set has more than one node
+		long long getNumReducedStrategies(int x)
+		{
+			if (!computeReducedStrategyCounts())
+				return 0;
+			return numReduced.empty() ? 1 : numReduced.at(x);
+		}
+
+		bool computeSequenceForm(SequenceForm &) const;
+		template <typename N> bool computeSequenceFormSolution(vector<vector<N> > &, N &, N) const;
+		void computeSubgamePerfect();
+		void computeSubgamePerfectParallel(int, int);
+		int difference(int);
+		void display(int, int) const;
+		vector<int> getEquilibriumPath();
+		int getNext(int, int) const;
+		vector<int> getPath(int) const;
+		void getPath(int, vector<int> &) const;
+		vector<int> getPayoffs(int) const;
+		void getPayoffs(int, vector<int> &) const;
+		vector<pair<int, int> > getReducedStrategy(int, long long);
+		int getStrategy(int) const;
+		vector<int> getValues(int) const;
+		int height(int);
+		int insert(vector<int>);
+		int insert(vector<int>, vector<int>);
 		int numNodesPerLevel(int);
-		bool search(TreeNode*);
+		int playReducedProfile(vector<long long>);
+		void printPath(int) const;
+		void printReducedStrategy(int, long long);
+		void printSequenceFormSolution() const;
+		void printSubgamePerfect();
+		void randTree(int, int);
+		int search(vector<int>) const;
+		void setInfoSet(int, int);
+		void setPayoffs(int, const vector<int> &);
+		template <typename T> bool toNormalForm(simGame<T>*, long long);
 };
 
-void SeqGame::computePath(TreeNode* node) // FINISH
-{
-	TreeNode* curNode = root;
-	vector<TreeNode*> temp = vector<TreeNode*>(node->getLevel() - 1); // tracks nodes on the way to node
-	// vector<int> checking;
-	
-	// curNode at level - 1
-	while (curNode->getLevel() < node->getLevel() - 1)
-	{
-		// keep track of the nodes curNode passes on the way to node
-		temp.at(curNode->getLevel()) = curNode;
-		
-		
-		// checking = vector<int>(node->getLevel() - 1);
-		// for (int i = 0; i < node->getLevel() - 1; i++)
-			// checking.at(i) = node->getLevel();
-		
-		/*
-		will always be the 0-th, 1st, 2nd,... node 
-		in the path down to level - i */
-		for (int i = 1; i < node->getLevel(); i++) // each level (level - i)
-		{
-			for (int j = 0; j < players[curNode->getNodePlayer()]->getNumStrats(); j++)
+// appends a node at level l below parent
+int SeqGame::addNode(int parent, int l)
+{
+	nodes.push_back(TreeNode(parent, l, l % numPlayers));
+	numNodes++;
+	numReduced.clear();
+	solved = false;
+	return nodes.size() - 1;
+}
+
+/*
+	Number of P_x's reduced strategies in the subgame at each node. A reduced strategy
+	only says what P_x does at the nodes P_x's own earlier choices don't rule out, which
+	merges all strategies that are equivalent in outcome. At P_x's nodes the counts of
+	the branches add, since P_x follows exactly one of them; at the others they
+	multiply. Counts are capped at 2^62.
+
+	Branch counts only add up to the right number if every node is its own
+	information set; two nodes in one information set share a single choice.
+	Returns false for such trees.
+*/
+bool SeqGame::computeReducedStrategyCounts()
+{
+	const long long cap = 1LL << 62;
+
+	if (!ordered)
+		pack();
+	if (!numReduced.empty())
+		return true;
+
+	int label = findSharedInfoSet();
+	if (label != -1)
+	{
+		cout << "ERROR: information set " << label << " has more than one node, so it has no reduced strategies here\n";
+		return false;
+	}
+
+	numReduced = vector<long long>(nodes.size() * numPlayers, 1);
+	for (int n = nodes.size() - 1; n >= 0; n--)
+	{
+		if (nodes.at(n).isPlaceholder())
+			continue;
+
+		for (int x = 0; x < numPlayers; x++)
+		{
+			bool own = (nodes.at(n).getNodePlayer() == x);
+			bool anyBranch = false;
+			long long count = own ? 0 : 1;
+			for (int c = nodes.at(n).getFirstChild(); c < nodes.at(n).getFirstChild() + nodes.at(n).getNumChildren(); c++)
 			{
-				curNode = curNode->getNext(j);
+				if (nodes.at(c).isPlaceholder())
+					continue;
+				long long branch = numReduced.at(c * numPlayers + x);
+				anyBranch = true;
+				if (own)
+					count = (count > cap - branch) ? cap : count + branch;
+				else
+					count = (count > cap / branch) ? cap : count * branch;
 			}
+			numReduced.at(n * numPlayers + x) = anyBranch ? count : 1;
 		}
 	}
-	
-	// players[curNode->getNodePlayer()]->getNumStrats()
-	// each strategy in that node in level - i
-	for (int j = 0; j < players[curNode->getNodePlayer()]->getNumStrats(); j++)
+	return true;
+}
+
+/*
+	Builds the sequence form in one pass over the tree. Nodes with the same information
+	set label must belong to the same player, have the same branches and be reached by
+	the same sequence of that player's own moves (perfect recall); label -1 makes a node
+	its own information set. An action is one of a node's branches that isn't a
+	placeholder.
+*/
+bool SeqGame::computeSequenceForm(SequenceForm &form) const
+{
+	map<int, pair<int, int> > labels; // label -> (player, information set)
+	vector<vector<vector<int> > > actions = vector<vector<vector<int> > >(2); // strategies of each information set's actions
+	vector<vector<int> > stack; // node, P_1's sequence, P_2's sequence
+
+	if (numPlayers != 2 || nodes.empty())
 	{
-		if (curNode->getNext(j) == node)
+		cout << "ERROR: the sequence form needs a nonempty tree with 2 players\n";
+		return false;
+	}
+
+	form.numSequences = vector<int>(2, 1);
+	form.firstSequence = vector<vector<int> >(2);
+	form.numActions = vector<vector<int> >(2);
+	form.parentSequence = vector<vector<int> >(2);
+	form.infoSetNodes = vector<vector<int> >(2);
+	form.nodeInfoSets = vector<int>(nodes.size(), -1);
+	form.leafSequences.clear();
+	form.leafPayoffs.clear();
+
+	stack.push_back(vector<int>{0, 0, 0});
+	while (!stack.empty())
+	{
+		vector<int> entry = stack.back();
+		int n = entry.at(0);
+		stack.pop_back();
+
+		vector<int> present;
+		for (int s = 0; s < nodes.at(n).getNumChildren(); s++)
+		{
+			if (getNext(n, s) != -1)
+				present.push_back(s);
+		}
+		if (present.empty())
+		{
+			form.leafSequences.push_back(vector<int>{entry.at(1), entry.at(2)});
+			form.leafPayoffs.push_back(getPayoffs(n));
+			continue;
+		}
+
+		int x = nodes.at(n).getNodePlayer();
+		int label = nodes.at(n).getInfoSet();
+		int h = -1;
+		if (label != -1 && labels.count(label) > 0)
 		{
-			// if node is found, all nodes recorded in temp are the path for node
-			node->setPathVertex(0, 0);
-			for (int n = 1; n < curNode->getLevel(); n++)
-				node->setPathVertex(n, temp.at(n)->getStrategy());
-			
-			node->setPathVertex(curNode->getLevel(), j);
-			return;
+			if (labels[label].first != x)
+			{
+				cout << "ERROR: information set " << label << " has nodes of more than one player\n";
+				return false;
+			}
+			h = labels[label].second;
+			if (actions.at(x).at(h) != present)
+			{
+				cout << "ERROR: the nodes in information set " << label << " have different branches\n";
+				return false;
+			}
+			if (form.parentSequence.at(x).at(h) != entry.at(x + 1))
+			{
+				cout << "ERROR: information set " << label << " breaks perfect recall\n";
+				return false;
+			}
+		}
+		else
+		{
+			h = form.firstSequence.at(x).size();
+			if (label != -1)
+				labels[label] = make_pair(x, h);
+			form.firstSequence.at(x).push_back(form.numSequences.at(x));
+			form.numActions.at(x).push_back(present.size());
+			form.parentSequence.at(x).push_back(entry.at(x + 1));
+			form.infoSetNodes.at(x).push_back(n);
+			actions.at(x).push_back(present);
+			form.numSequences.at(x) += present.size();
+		}
+		form.nodeInfoSets.at(n) = h;
+
+		for (int a = present.size() - 1; a >= 0; a--)
+		{
+			vector<int> next = entry;
+			next.at(0) = getNext(n, present.at(a));
+			next.at(x + 1) = form.firstSequence.at(x).at(h) + a;
+			stack.push_back(next);
 		}
 	}
-	
-	// move up a level to check the next level - 1 node to the right
-	curNode = temp.at(curNode->getLevel() - 1);
+	return true;
 }
 
-void SeqGame::destroySubTree(TreeNode* curNode)
+/*
+	Realization plans of an equilibrium of the zero-sum game with P_1's payoffs and its
+	value for P_1, from one LP whose size is linear in the tree (Koller, Megiddo and
+	von Stengel). With E x = e and F y = f the players' sequence-form constraints and
+	A the payoff matrix of the sequence pairs,
+		max q_0  s.t.  F^T q - A^T x <= 0,  E x <= e,  x, q >= 0
+	where q holds P_2's value at each of their information sets; P_2's plan comes from
+	the dual. Shifting the payoffs to be positive makes q >= 0 and relaxing E x = e to
+	E x <= e harmless, so the LP fits LinearProgram's form; the plans are completed
+	afterwards, which can only help the player they belong to.
+*/
+template <typename N>
+bool SeqGame::computeSequenceFormSolution(vector<vector<N> > &plans, N &value, N eps) const
 {
-	if (curNode)
+	SequenceForm form;
+	if (!computeSequenceForm(form))
+		return false;
+
+	int numSeqs0 = form.numSequences.at(0);
+	int numSeqs1 = form.numSequences.at(1);
+	int numSets0 = form.firstSequence.at(0).size();
+	int numSets1 = form.firstSequence.at(1).size();
+	int numVariables = numSeqs0 + numSets1 + 1; // x, then q_0 and q for each of P_2's information sets
+	int numConstraints = 1 + numSets0 + numSeqs1;
+
+	int minPayoff = form.leafPayoffs.at(0).at(0);
+	for (int l = 0; (unsigned)l < form.leafPayoffs.size(); l++)
+	{
+		if (form.leafPayoffs.at(l).at(0) < minPayoff)
+			minPayoff = form.leafPayoffs.at(l).at(0);
+	}
+	N shift = N(1) - N(minPayoff);
+
+	vector<vector<N> > A = vector<vector<N> >(numConstraints, vector<N>(numVariables, N(0)));
+	vector<N> b = vector<N>(numConstraints, N(0));
+	vector<N> c = vector<N>(numVariables, N(0));
+	c.at(numSeqs0) = N(1);
+
+	// E x <= e
+	A.at(0).at(0) = N(1);
+	b.at(0) = N(1);
+	for (int h = 0; h < numSets0; h++)
+	{
+		A.at(1 + h).at(form.parentSequence.at(0).at(h)) -= N(1);
+		for (int a = 0; a < form.numActions.at(0).at(h); a++)
+			A.at(1 + h).at(form.firstSequence.at(0).at(h) + a) += N(1);
+	}
+
+	// F^T q - A^T x <= 0, one row per sequence of P_2
+	int row = 1 + numSets0;
+	A.at(row).at(numSeqs0) = N(1);
+	for (int h = 0; h < numSets1; h++)
+	{
+		A.at(row + form.parentSequence.at(1).at(h)).at(numSeqs0 + 1 + h) -= N(1);
+		for (int a = 0; a < form.numActions.at(1).at(h); a++)
+			A.at(row + form.firstSequence.at(1).at(h) + a).at(numSeqs0 + 1 + h) += N(1);
+	}
+	for (int l = 0; (unsigned)l < form.leafPayoffs.size(); l++)
+		A.at(row + form.leafSequences.at(l).at(1)).at(form.leafSequences.at(l).at(0)) -= N(form.leafPayoffs.at(l).at(0)) + shift;
+
+	LinearProgram<N> lp(A, b, c, eps);
+	if (!lp.solve())
+		return false;
+
+	vector<N> solution = lp.getSolution();
+	vector<N> dual = lp.getDualSolution();
+	plans = vector<vector<N> >(2);
+	plans.at(0) = vector<N>(solution.begin(), solution.begin() + numSeqs0);
+	plans.at(1) = vector<N>(dual.begin() + row, dual.end());
+
+	// information sets come after the one holding their parent sequence, so one pass completes the plans
+	plans.at(0).at(0) = N(1);
+	for (int h = 0; h < numSets0; h++)
+	{
+		N total = N(0);
+		for (int a = 0; a < form.numActions.at(0).at(h); a++)
+			total += plans.at(0).at(form.firstSequence.at(0).at(h) + a);
+		N missing = plans.at(0).at(form.parentSequence.at(0).at(h)) - total;
+		if (missing > N(0))
+			plans.at(0).at(form.firstSequence.at(0).at(h)) += missing;
+	}
+	plans.at(1).at(0) = N(1);
+	for (int h = 0; h < numSets1; h++)
 	{
-		for (int i = 0; i < players[curNode->getNodePlayer()]->getNumStrats(); i++)
+		N total = N(0);
+		for (int a = 0; a < form.numActions.at(1).at(h); a++)
+			total += plans.at(1).at(form.firstSequence.at(1).at(h) + a);
+		if (total > N(0))
 		{
-			if (curNode->getNext(i) != NULL)
-				destroySubTree(curNode = curNode->getNext(i + 1));
+			N scale = plans.at(1).at(form.parentSequence.at(1).at(h)) / total;
+			for (int a = 0; a < form.numActions.at(1).at(h); a++)
+				plans.at(1).at(form.firstSequence.at(1).at(h) + a) *= scale;
 		}
-		delete curNode;
 	}
+
+	value = lp.getObjectiveValue() - shift;
+	return true;
+}
+
+/*
+	Backward induction in one reverse sweep of the array, which visits every node's
+	branches before the node.
+*/
+void SeqGame::computeSubgamePerfect()
+{
+	if (!ordered)
+		pack();
+
+	values = vector<int>(nodes.size() * numPlayers, 0);
+	for (int n = nodes.size() - 1; n >= 0; n--)
+		evaluateNode(n);
+	solved = true;
+}
+
+/*
+	Backward induction on numThreads threads (0 for all of them). A task for a subtree
+	with more than cutoff nodes spawns a task for each branch; smaller subtrees are
+	solved sequentially. Whichever task finishes a node's last branch evaluates the
+	node and moves up, so no task waits on another. Each node is evaluated once from
+	its branches' values, so the result is the same for any number of threads.
+*/
+void SeqGame::computeSubgamePerfectParallel(int numThreads, int cutoff)
+{
+	if (!ordered)
+		pack();
+	if (nodes.empty())
+		return;
+
+	// subtree sizes; once a node spawns its branches, its entry counts the branches left
+	int size = nodes.size();
+	vector<atomic<int> > remaining(size);
+	for (int n = size - 1; n >= 0; n--)
+	{
+		int count = nodes.at(n).isPlaceholder() ? 0 : 1;
+		for (int c = nodes.at(n).getFirstChild(); c < nodes.at(n).getFirstChild() + nodes.at(n).getNumChildren(); c++)
+			count += remaining.at(c);
+		remaining.at(n) = count;
+	}
+
+	values = vector<int>(size * numPlayers, 0);
+	TaskScheduler scheduler(numThreads);
+	vector<vector<int> > stacks = vector<vector<int> >(scheduler.getNumThreads());
+
+	function<void(int, int)> solve = [&](int worker, int n)
+	{
+		if (remaining.at(n) > cutoff)
+		{
+			int numBranches = 0;
+			for (int s = 0; s < nodes.at(n).getNumChildren(); s++)
+			{
+				if (getNext(n, s) != -1)
+					numBranches++;
+			}
+			if (numBranches > 0)
+			{
+				remaining.at(n) = numBranches;
+				for (int s = 0; s < nodes.at(n).getNumChildren(); s++)
+				{
+					int c = getNext(n, s);
+					if (c != -1)
+						scheduler.spawn(worker, [&solve, c](int w) { solve(w, c); });
+				}
+				return;
+			}
+		}
+		solveSubtree(n, stacks.at(worker));
+
+		// the last branch to finish evaluates its parent
+		n = nodes.at(n).getParent();
+		while (n != -1 && --remaining.at(n) == 0)
+		{
+			evaluateNode(n);
+			n = nodes.at(n).getParent();
+		}
+	};
+	scheduler.run([&solve](int w) { solve(w, 0); });
+	solved = true;
 }
 
-int SeqGame::difference(TreeNode* node)
+int SeqGame::difference(int node)
 {
-	int size = players[node->getNodePlayer()]->getNumStrats();
-	vector<int> heights = vector<int>(size);
 	int maxHeight = -1;
 	int minHeight = std::numeric_limits<int>::max();
 	int diff;
-	
-	for (int i = 0; i < size; i++)
-		heights.at(i) = height(node->getNext(i));
-	for (int i = 0; i < size; i++)
+
+	for (int s = 0; s < nodes.at(node).getNumChildren(); s++)
 	{
-		if (heights.at(i) > maxHeight)
-			maxHeight = heights.at(i);
-		if (heights.at(i) < minHeight)
-			minHeight = heights.at(i);
+		int h = height(getNext(node, s));
+		if (h > maxHeight)
+			maxHeight = h;
+		if (h < minHeight)
+			minHeight = h;
 	}
 	diff = maxHeight - minHeight;
 	return diff;
 }
 
 /*
-			-1
-		0		1
-	0	1
-	
-			1
-		2		3
-	
-d1
-	d2
-
-	ed2
-	d3
-	
-	ed3
-ed1
+	P_1, s_{-1}
+		P_2, s_1
+			s_1: (3, 1)
+		...
 */
+void SeqGame::display(int node, int level) const
+{
+	if (node != -1)
+	{
+		for (int i = 0; i < level; i++)
+			cout << "        ";
 
-void SeqGame::display(TreeNode* node, int level)
-{
-	int num = rand();
-	cout << "\nDISPLAY:  " << num << endl;
-	// cout << num << endl;
-	
-	int i, strat;
-	if (node)
-	{
-		for (strat = 0; strat < node->getSizeNext() - 1; strat++)
-		{
-			cout << "\nstrat: " << strat << endl;
-			
-			display(node->getNext(strat), level + 1);
-		
-			printf("\n");
-			
-			for (i = 0; i < level && node != root; i++)
-				cout << "        ";
-			
-			if (node == root)
-				cout << "P_" << node->getNodePlayer() + 1 << ", s_{" << node->getStrategy() << "}";
-			else
-				cout << "P_" << node->getNodePlayer() + 1 << ", s_" << node->getStrategy() + 1;
+		if (node == 0)
+			cout << "P_" << nodes.at(node).getNodePlayer() + 1 << ", s_{" << getStrategy(node) << "}";
+		else if (nodes.at(node).isLeaf())
+		{
+			vector<int> payoffs = getPayoffs(node);
+			cout << "s_" << getStrategy(node) + 1 << ": (";
+			for (int x = 0; x < numPlayers; x++)
+			{
+				cout << payoffs.at(x);
+				if (x < numPlayers - 1)
+					cout << ", ";
+			}
+			cout << ")";
 		}
-		
-		display(node->getNext(node->getSizeNext() - 1), level + 1);
+		else
+			cout << "P_" << nodes.at(node).getNodePlayer() + 1 << ", s_" << getStrategy(node) + 1;
+		cout << endl;
+
+		for (int strat = 0; strat < nodes.at(node).getNumChildren(); strat++)
+			display(getNext(node, strat), level + 1);
 	}
-	cout << "   DONE:  " << num << "\n";
 }
 
-void SeqGame::displayPreOrder(TreeNode* node) const
+void SeqGame::displayPreOrder(int node) const
 {
-	cout << "DISPLAYPREORDER\n";
-	if (node)
+	if (node != -1)
 	{
-		cout << "P_" << node->getNodePlayer() << ", s_" << node->getStrategy() << "  ";
-		cout << node->getPayoff() << endl;
-		for (int i = 0; i < players[1 - node->getNodePlayer()]->getNumStrats(); i++)
-			displayPreOrder(node->getNext(i));
+		cout << "P_" << nodes.at(node).getNodePlayer() << ", s_" << getStrategy(node) << endl;
+		for (int s = 0; s < nodes.at(node).getNumChildren(); s++)
+			displayPreOrder(getNext(node, s));
 	}
-	
-	cout << "END OF DISPLAYPREORDER\n";
 }
 
-int SeqGame::height(TreeNode* node) // FINISH
+// strategies played from the root to the subgame-perfect outcome
+vector<int> SeqGame::getEquilibriumPath()
 {
-	cout << "GETTING HEIGHT\n";
-	
-	int size = players[node->getNodePlayer()]->getNumStrats();
-	vector<int> heights = vector<int>(size);
-	int maxHeight = -1;
-	int h = 0;
-	
-	if (node)
+	vector<int> path;
+
+	if (!solved)
+		computeSubgamePerfect();
+
+	int n = getRoot();
+	while (n != -1 && nodes.at(n).getChoice() != -1)
+	{
+		path.push_back(nodes.at(n).getChoice());
+		n = nodes.at(n).getFirstChild() + nodes.at(n).getChoice();
+	}
+	return path;
+}
+
+// node reached by playing s at node n, -1 if there isn't one
+int SeqGame::getNext(int n, int s) const
+{
+	if (s >= nodes.at(n).getNumChildren() || nodes.at(nodes.at(n).getFirstChild() + s).isPlaceholder())
+		return -1;
+	return nodes.at(n).getFirstChild() + s;
+}
+
+// -1, then the strategy played at each level to reach node n
+vector<int> SeqGame::getPath(int n) const
+{
+	vector<int> path;
+	getPath(n, path);
+	return path;
+}
+
+// same, written into path so a caller walking many nodes can reuse one vector
+void SeqGame::getPath(int n, vector<int> &path) const
+{
+	path.resize(nodes.at(n).getLevel() + 1);
+	path.at(0) = -1;
+	for (int lev = nodes.at(n).getLevel(); lev > 0; lev--)
 	{
-		for (int i = 0; i < size; i++)
-			heights.at(i) = height(node->getNext(i));
-		for (int i = 0; i < size; i++)
+		path.at(lev) = getStrategy(n);
+		n = nodes.at(n).getParent();
+	}
+}
+
+// payoffs of a leaf, 0 for a leaf without any
+vector<int> SeqGame::getPayoffs(int n) const
+{
+	vector<int> payoffs;
+	getPayoffs(n, payoffs);
+	return payoffs;
+}
+
+// same, written into payoffs
+void SeqGame::getPayoffs(int n, vector<int> &payoffs) const
+{
+	payoffs.assign(numPlayers, 0);
+	if (nodes.at(n).getPayoffIndex() != -1)
+	{
+		for (int x = 0; x < numPlayers; x++)
+			payoffs.at(x) = payoffPool.at(nodes.at(n).getPayoffIndex() + x);
+	}
+}
+
+// strategy played to reach node n, -1 at the root
+int SeqGame::getStrategy(int n) const
+{
+	if (nodes.at(n).getParent() == -1)
+		return -1;
+	return n - nodes.at(nodes.at(n).getParent()).getFirstChild();
+}
+
+vector<int> SeqGame::getValues(int n) const
+{
+	return vector<int>(values.begin() + n * numPlayers, values.begin() + (n + 1) * numPlayers);
+}
+
+/*
+	Node n's player picks the branch whose value is best for them, ties going to the
+	lowest strategy, and n takes that branch's value. Leaves take their payoffs.
+*/
+void SeqGame::evaluateNode(int n)
+{
+	TreeNode &node = nodes.at(n);
+	if (node.isPlaceholder())
+		return;
+
+	int best = -1;
+	int x = node.getNodePlayer();
+	for (int c = node.getFirstChild(); c < node.getFirstChild() + node.getNumChildren(); c++)
+	{
+		if (!nodes.at(c).isPlaceholder()
+			&& (best == -1 || values.at(c * numPlayers + x) > values.at(best * numPlayers + x)))
+			best = c;
+	}
+
+	if (best == -1) // leaf
+	{
+		node.setChoice(-1);
+		if (node.getPayoffIndex() != -1)
 		{
-			if (heights.at(i) > maxHeight)
-				maxHeight = heights.at(i);
+			for (int y = 0; y < numPlayers; y++)
+				values.at(n * numPlayers + y) = payoffPool.at(node.getPayoffIndex() + y);
 		}
-		h = maxHeight + 1;
 	}
-	return h;
+	else
+	{
+		node.setChoice(best - node.getFirstChild());
+		for (int y = 0; y < numPlayers; y++)
+			values.at(n * numPlayers + y) = values.at(best * numPlayers + y);
+	}
+}
+
+// label of an information set with more than one decision node, -1 if there isn't one
+int SeqGame::findSharedInfoSet() const
+{
+	map<int, int> labels; // label -> node
+	for (int n = 0; (unsigned)n < nodes.size(); n++)
+	{
+		int label = nodes.at(n).getInfoSet();
+		if (label == -1 || nodes.at(n).isPlaceholder() || nodes.at(n).isLeaf())
+			continue;
+		if (labels.count(label) > 0)
+			return label;
+		labels[label] = n;
+	}
+	return -1;
+}
+
+/*
+	P_x's k-th reduced strategy as (node, strategy) pairs in preorder. The ranks are
+	mixed-radix: at P_x's nodes k picks a branch by the cumulative branch counts, and at
+	the other players' nodes k splits into one digit per branch. Empty if an
+	information set has more than one node.
+*/
+vector<pair<int, int> > SeqGame::getReducedStrategy(int x, long long k)
+{
+	vector<pair<int, int> > strategy;
+	vector<pair<int, long long> > stack;
+
+	if (!computeReducedStrategyCounts())
+		return strategy;
+	if (!nodes.empty())
+		stack.push_back(make_pair(0, k));
+	while (!stack.empty())
+	{
+		int n = stack.back().first;
+		long long rank = stack.back().second;
+		stack.pop_back();
+
+		if (nodes.at(n).getNodePlayer() == x)
+		{
+			for (int s = 0; s < nodes.at(n).getNumChildren(); s++)
+			{
+				int c = getNext(n, s);
+				if (c == -1)
+					continue;
+				if (rank < numReduced.at(c * numPlayers + x))
+				{
+					strategy.push_back(make_pair(n, s));
+					stack.push_back(make_pair(c, rank));
+					break;
+				}
+				rank -= numReduced.at(c * numPlayers + x);
+			}
+		}
+		else
+		{
+			vector<pair<int, long long> > branches;
+			for (int s = 0; s < nodes.at(n).getNumChildren(); s++)
+			{
+				int c = getNext(n, s);
+				if (c == -1)
+					continue;
+				branches.push_back(make_pair(c, rank % numReduced.at(c * numPlayers + x)));
+				rank /= numReduced.at(c * numPlayers + x);
+			}
+			for (int b = branches.size() - 1; b >= 0; b--)
+				stack.push_back(branches.at(b));
+		}
+	}
+	return strategy;
+}
+
+// makes room for count branches at node n, moving its existing branches to the end if they can't grow in place
+void SeqGame::growBranches(int n, int count)
+{
+	int first = nodes.at(n).getFirstChild();
+	int num = nodes.at(n).getNumChildren();
+	if (num >= count)
+		return;
+
+	if (num > 0 && first + num != (int)nodes.size())
+	{
+		int newFirst = nodes.size();
+		for (int s = 0; s < num; s++)
+		{
+			nodes.push_back(nodes.at(first + s));
+			TreeNode &moved = nodes.back();
+			for (int c = moved.getFirstChild(); c < moved.getFirstChild() + moved.getNumChildren(); c++)
+				nodes.at(c).setParent(newFirst + s);
+			nodes.at(first + s) = TreeNode(); // unreachable from now on
+		}
+		first = newFirst;
+		ordered = false;
+	}
+	else if (num == 0)
+		first = nodes.size();
+
+	for (int s = num; s < count; s++)
+		nodes.push_back(TreeNode(n, nodes.at(n).getLevel() + 1, -1));
+	nodes.at(n).setChildren(first, count);
+	numReduced.clear();
+}
+
+int SeqGame::height(int node)
+{
+	if (node == -1)
+		return 0;
+	if (!ordered)
+		pack();
+
+	// the reverse sweep finds every node's height below it
+	vector<int> heights = vector<int>(nodes.size(), 0);
+	for (int n = nodes.size() - 1; n >= node; n--)
+	{
+		for (int s = 0; s < nodes.at(n).getNumChildren(); s++)
+		{
+			int c = getNext(n, s);
+			if (c != -1 && heights.at(c) + 1 > heights.at(n))
+				heights.at(n) = heights.at(c) + 1;
+		}
+	}
+	return heights.at(node);
 }
 
 /*
@@ -241,66 +803,53 @@ int SeqGame::height(TreeNode* node) // FINISH
 	0	1
 */
 
-// Copy tree from level l down from previous node in l
-// insert new payoffs NLR
-void SeqGame::insert(TreeNode* root, vector<int> p) // FINISH
-{
-	cout << "INSERTING\n";
-	
-	TreeNode* curNode;
-	TreeNode* newNode = new TreeNode;
-	newNode->setPath(p);
-	
-	if (!root)
-	{
-		setRoot(newNode);
-		getRoot()->setStrategy(-1); // all paths start with -1
-		cout << "DONE INSERTING\n\n";
-		return;
+// creates the node at path p (-1 first, then the strategy played at each level) and any missing nodes above it
+int SeqGame::insert(vector<int> p)
+{
+	if (nodes.empty())
+		addNode(-1, 0); // all paths start with -1
+
+	int n = 0;
+	for (int lev = 1; (unsigned)lev < p.size(); lev++)
+	{
+		growBranches(n, p.at(lev) + 1);
+		n = nodes.at(n).getFirstChild() + p.at(lev);
+		if (nodes.at(n).isPlaceholder())
+		{
+			nodes.at(n).setPlayer(lev % numPlayers);
+			numNodes++;
+			numReduced.clear();
+		}
 	}
-	
-	// if (path.size() != (unsigned)height(this->getRoot()))
-	// {
-		// cout << "This is an invalid node.\n";
-		// return;
-	// }
-	
-	curNode = root;
-	int lev = 0;
-	// follow path to spot before the new spot
-	while (curNode && (unsigned)lev < p.size() - 2) // && curNode->getNext(path.at(i))       && curNode->getPath() != path
-	{		
-		lev++;
-		cout << "lev: " << lev << endl;
-		cout << "path at " << lev << ": " << p.at(lev) << endl;
-		cout << "size: " << curNode->getSizeNext() << endl;
-		curNode = curNode->getNext(p.at(lev));
-		cout << "test1\n";
-	}
-	cout << "test2\n";
-	curNode->addNext(); // create spot in next, will be the last position
-	cout << "test3\n";
-	curNode->setNext(curNode->getSizeNext() - 1, newNode);
-	curNode->setNextPlayer(curNode->getSizeNext() - 1, 1 - curNode->getNodePlayer());
-	cout << "DONE INSERTING\n\n";
+	solved = false;
+	return n;
+}
+
+// inserts the leaf at path p with the given payoffs
+int SeqGame::insert(vector<int> p, vector<int> payoffs)
+{
+	int n = insert(p);
+	setPayoffs(n, payoffs);
+	return n;
 }
 
+// number of nodes at level i of a complete tree where the players move in turn
 int SeqGame::numNodesPerLevel(int i)
 {
-	int num = -1;
+	int num = 1;
 	int r = -1;
-	
+
 	if (i == 0)
-		return 0;
+		return 1;
 	else if (i % numPlayers == 0)
 	{
-		for (int x = 0; x < numPlayers; i++)
+		for (int x = 0; x < numPlayers; x++)
 			num *= pow(players[x]->getNumStrats(), i / numPlayers);
 	}
 	else if (i % numPlayers > 0)
 	{
 		r = i % numPlayers;
-		for (int x = 0; x < numPlayers; i++)
+		for (int x = 0; x < numPlayers; x++)
 		{
 			if (r > 0)
 			{
@@ -314,28 +863,387 @@ int SeqGame::numNodesPerLevel(int i)
 	return num;
 }
 
-bool SeqGame::search(TreeNode* item) // FINISH
+// rebuilds the array breadth-first, dropping slots left behind by growBranches()
+void SeqGame::pack()
 {
-	TreeNode* curNode = root;
-	
-	while (curNode)
+	vector<TreeNode> packed;
+	vector<int> order; // old index of each packed node
+
+	packed.reserve(numNodes);
+	if (!nodes.empty())
+	{
+		order.push_back(0);
+		packed.push_back(nodes.at(0));
+	}
+	for (int i = 0; (unsigned)i < order.size(); i++)
 	{
-		while (curNode->getLevel() != item->getLevel())
+		const TreeNode &old = nodes.at(order.at(i));
+		packed.at(i).setChildren(old.getNumChildren() > 0 ? order.size() : -1, old.getNumChildren());
+		for (int c = old.getFirstChild(); c < old.getFirstChild() + old.getNumChildren(); c++)
 		{
-			curNode->getNext(0);
+			order.push_back(c);
+			packed.push_back(nodes.at(c));
+			packed.back().setParent(i);
 		}
-		for (int i = 0; i < players[curNode->getNodePlayer()]->getNumStrats(); i++)
+	}
+	nodes.swap(packed);
+	numReduced.clear();
+	ordered = true;
+	solved = false;
+}
+
+/*
+	Leaf reached when each P_x plays their ranks.at(x)-th reduced strategy. Only the
+	path is walked, so profiles can be streamed without listing any strategies.
+	-1 if an information set has more than one node.
+*/
+int SeqGame::playReducedProfile(vector<long long> ranks)
+{
+	if (!computeReducedStrategyCounts())
+		return -1;
+
+	int n = getRoot();
+	while (n != -1 && !nodes.at(n).isLeaf())
+	{
+		int y = nodes.at(n).getNodePlayer();
+		int next = -1;
+
+		// the mover's rank picks the branch
+		for (int s = 0; s < nodes.at(n).getNumChildren() && next == -1; s++)
 		{
-			if (curNode->getStrategy() == item->getStrategy())
-				return true;
+			int c = getNext(n, s);
+			if (c == -1)
+				continue;
+			if (ranks.at(y) < numReduced.at(c * numPlayers + y))
+				next = c;
 			else
+				ranks.at(y) -= numReduced.at(c * numPlayers + y);
+		}
+		if (next == -1)
+			break; // every branch is a placeholder
+
+		// everyone else keeps the digit for that branch
+		for (int x = 0; x < numPlayers; x++)
+		{
+			if (x == y)
+				continue;
+			for (int c = nodes.at(n).getFirstChild(); c < next; c++)
 			{
-				cout << "else\n";
-				return false;
+				if (!nodes.at(c).isPlaceholder())
+					ranks.at(x) /= numReduced.at(c * numPlayers + x);
 			}
+			ranks.at(x) %= numReduced.at(next * numPlayers + x);
+		}
+		n = next;
+	}
+	return n;
+}
+
+// root or (s_1, s_2)
+void SeqGame::printPath(int n) const
+{
+	vector<int> path = getPath(n);
+	if (path.size() == 1)
+		cout << "root";
+	else
+	{
+		cout << "(";
+		for (int lev = 1; (unsigned)lev < path.size(); lev++)
+		{
+			cout << "s_" << path.at(lev) + 1;
+			if ((unsigned)lev < path.size() - 1)
+				cout << ", ";
+		}
+		cout << ")";
+	}
+}
+
+// P_1: s_3 = (root: s_1, (s_2, s_1): s_2)
+void SeqGame::printReducedStrategy(int x, long long k)
+{
+	if (!computeReducedStrategyCounts())
+		return;
+	vector<pair<int, int> > strategy = getReducedStrategy(x, k);
+
+	cout << "P_" << x + 1 << ": s_" << k + 1 << " = (";
+	for (int a = 0; (unsigned)a < strategy.size(); a++)
+	{
+		printPath(strategy.at(a).first);
+		cout << ": s_" << strategy.at(a).second + 1;
+		if ((unsigned)a < strategy.size() - 1)
+			cout << ", ";
+	}
+	cout << ")\n";
+}
+
+/*
+	v = 0
+	P_1 at root: s_1 0.5, s_2 0.5
+	P_2 at (s_1): s_1 0.5, s_2 0.5
+*/
+void SeqGame::printSequenceFormSolution() const
+{
+	SequenceForm form;
+	vector<vector<double> > plans;
+	double value;
+
+	if (!computeSequenceForm(form) || !computeSequenceFormSolution(plans, value, 1e-9))
+		return;
+
+	cout << "\nZero-sum solution (P_1's payoffs):\n";
+	cout << "--------------------------\n";
+	cout << "v = " << value << endl;
+	for (int x = 0; x < 2; x++)
+		for (int h = 0; (unsigned)h < form.firstSequence.at(x).size(); h++)
+		{
+			int n = form.infoSetNodes.at(x).at(h);
+			double reach = plans.at(x).at(form.parentSequence.at(x).at(h));
+
+			cout << "P_" << x + 1 << " at ";
+			printPath(n);
+			if (getInfoSet(n) != -1)
+				cout << " (information set " << getInfoSet(n) << ")";
+			cout << ":";
+			if (reach <= 1e-9)
+			{
+				cout << " not reached\n";
+				continue;
+			}
+			for (int a = 0, s = 0; a < form.numActions.at(x).at(h); s++)
+			{
+				if (getNext(n, s) == -1)
+					continue;
+				cout << " s_" << s + 1 << " " << plans.at(x).at(form.firstSequence.at(x).at(h) + a) / reach;
+				a++;
+				if (a < form.numActions.at(x).at(h))
+					cout << ",";
+			}
+			cout << endl;
+		}
+}
+
+// value of every node, then the equilibrium path and outcome
+void SeqGame::printSubgamePerfect()
+{
+	vector<int> stack;
+	vector<int> path;
+	int label = -1;
+
+	if (nodes.empty())
+	{
+		cout << "The tree is empty.\n";
+		return;
+	}
+	label = findSharedInfoSet();
+	if (label != -1)
+	{
+		cout << "ERROR: information set " << label << " has more than one node, so backward induction doesn't apply\n";
+		return;
+	}
+	if (!solved)
+		computeSubgamePerfect();
+
+	cout << "\nSUBGAME-PERFECT EQUILIBRIUM:\n";
+	cout << "--------------------------\n";
+	stack.push_back(0);
+	while (!stack.empty())
+	{
+		int n = stack.back();
+		stack.pop_back();
+
+		for (int i = 0; i < nodes.at(n).getLevel(); i++)
+			cout << "        ";
+		if (n == 0)
+			cout << "root";
+		else
+			cout << "s_" << getStrategy(n) + 1;
+		cout << ": (";
+		for (int x = 0; x < numPlayers; x++)
+		{
+			cout << getValue(n, x);
+			if (x < numPlayers - 1)
+				cout << ", ";
+		}
+		cout << ")";
+		if (nodes.at(n).getChoice() != -1)
+			cout << "  P_" << nodes.at(n).getNodePlayer() + 1 << " plays s_" << nodes.at(n).getChoice() + 1;
+		cout << endl;
+
+		for (int s = nodes.at(n).getNumChildren() - 1; s >= 0; s--)
+		{
+			if (getNext(n, s) != -1)
+				stack.push_back(getNext(n, s));
+		}
+	}
+
+	path = getEquilibriumPath();
+	cout << "\nEquilibrium path: (";
+	for (int n = 0; (unsigned)n < path.size(); n++)
+	{
+		cout << "s_" << path.at(n) + 1;
+		if ((unsigned)n < path.size() - 1)
+			cout << ", ";
+	}
+	cout << ")\nOutcome: (";
+	for (int x = 0; x < numPlayers; x++)
+	{
+		cout << getValue(0, x);
+		if (x < numPlayers - 1)
+			cout << ", ";
+	}
+	cout << ")\n";
+}
+
+// complete tree of the given depth where every node has numBranches branches, random payoffs from 0 to 99
+void SeqGame::randTree(int depth, int numBranches)
+{
+	long long size = 1, levelSize = 1;
+	for (int lev = 1; lev <= depth; lev++)
+	{
+		levelSize *= numBranches;
+		size += levelSize;
+	}
+
+	nodes.clear();
+	payoffPool.clear();
+	values.clear();
+	numNodes = 0;
+	ordered = true;
+	nodes.reserve(size);
+	payoffPool.reserve(levelSize * numPlayers);
+
+	// breadth-first, so each level's branches are contiguous
+	addNode(-1, 0);
+	int levelStart = 0;
+	for (int lev = 1; lev <= depth; lev++)
+	{
+		int levelEnd = nodes.size();
+		for (int n = levelStart; n < levelEnd; n++)
+		{
+			nodes.at(n).setChildren(nodes.size(), numBranches);
+			for (int s = 0; s < numBranches; s++)
+				addNode(n, lev);
+		}
+		levelStart = levelEnd;
+	}
+
+	for (int n = levelStart; (unsigned)n < nodes.size(); n++)
+	{
+		nodes.at(n).setPayoffIndex(payoffPool.size());
+		for (int x = 0; x < numPlayers; x++)
+			payoffPool.push_back(rand() % 100);
+	}
+	solved = false;
+}
+
+// node at path p, -1 if it isn't in the tree
+int SeqGame::search(vector<int> p) const
+{
+	int n = getRoot();
+	for (int lev = 1; n != -1 && (unsigned)lev < p.size(); lev++)
+		n = getNext(n, p.at(lev));
+	return n;
+}
+
+// evaluates the subtree at root in reverse preorder, which puts branches before their nodes
+void SeqGame::solveSubtree(int root, vector<int> &order)
+{
+	order.clear();
+	order.push_back(root);
+	for (int i = 0; (unsigned)i < order.size(); i++)
+	{
+		for (int s = nodes.at(order.at(i)).getNumChildren() - 1; s >= 0; s--)
+		{
+			int c = getNext(order.at(i), s);
+			if (c != -1)
+				order.push_back(c);
+		}
+	}
+	for (int i = order.size() - 1; i >= 0; i--)
+		evaluateNode(order.at(i));
+}
+
+// puts node n in the information set with the given label, -1 to make it its own
+void SeqGame::setInfoSet(int n, int label)
+{
+	nodes.at(n).setInfoSet(label);
+	numReduced.clear();
+}
+
+void SeqGame::setPayoffs(int n, const vector<int> &payoffs)
+{
+	if (nodes.at(n).getPayoffIndex() == -1)
+	{
+		nodes.at(n).setPayoffIndex(payoffPool.size());
+		payoffPool.resize(payoffPool.size() + numPlayers, 0);
+	}
+	for (int x = 0; x < numPlayers && (unsigned)x < payoffs.size(); x++)
+		payoffPool.at(nodes.at(n).getPayoffIndex() + x) = payoffs.at(x);
+	solved = false;
+}
+
+/*
+	Writes the reduced normal form into game: P_x's strategies are the reduced
+	strategies in rank order and each profile's payoffs are those of the leaf it
+	reaches. Profiles are streamed straight into game's payoff storage. Returns false
+	without touching game if there would be more than maxOutcomes outcomes, a player
+	would have more strategies than an int holds, or an information set has more than
+	one node.
+*/
+template <typename T>
+bool SeqGame::toNormalForm(simGame<T>* game, long long maxOutcomes)
+{
+	vector<int> numStrats = vector<int>(numPlayers);
+	vector<long long> ranks = vector<long long>(numPlayers, 0);
+	long long numOutcomes = 1;
+
+	if (nodes.empty() || game->getNumPlayers() != numPlayers)
+	{
+		cout << "ERROR: the normal form needs a nonempty tree and a game with " << numPlayers << " players\n";
+		return false;
+	}
+
+	if (!computeReducedStrategyCounts())
+		return false;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		long long count = getNumReducedStrategies(x);
+		if (count > maxOutcomes / numOutcomes)
+		{
+			cout << "ERROR: the reduced normal form has more than " << maxOutcomes << " outcomes\n";
+			return false;
+		}
+		if (count > std::numeric_limits<int>::max())
+		{
+			cout << "ERROR: P_" << x + 1 << " has more than " << std::numeric_limits<int>::max() << " reduced strategies\n";
+			return false;
+		}
+		numOutcomes *= count;
+		numStrats.at(x) = count;
+	}
+
+	game->setAllNumStrats(numStrats);
+	vector<int> profile = vector<int>(numPlayers, 0);
+	vector<int> payoffs;
+	for (long long o = 0; o < numOutcomes; o++)
+	{
+		for (int x = 0; x < numPlayers; x++)
+			ranks.at(x) = profile.at(x);
+
+		getPayoffs(playReducedProfile(ranks), payoffs);
+		for (int x = 0; x < numPlayers; x++)
+			game->setPayoff(profile, x, payoffs.at(x));
+
+		// next profile, P_1 fastest
+		for (int x = 0; x < numPlayers; x++)
+		{
+			profile.at(x)++;
+			if (profile.at(x) < numStrats.at(x))
+				break;
+			profile.at(x) = 0;
 		}
 	}
 	return true;
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -9,6 +9,17 @@ Purpose: class for simultaneous aspects of games
 #define SIMGAME_H
 #include "Player.h"
 #include "LinkedList.h"
+#include "LinearProgram.h"
+#include "CanonicalForm.h"
+#include "AnalysisCache.h"
+#include "ResultWriter.h"
+
+// one communication pattern's result from simGame::evaluateCommunication()
+struct CommunicationOutcome
+{
+	vector<int> outcome;
+	bool paretoOptimal;
+};
 
 // "Simultaneous Game" a vector of matrices (vectors of vectors) of linked lists and relevant data
 template <typename T>
@@ -20,6 +31,10 @@ class simGame
 		int numOutcomes;
 		vector<vector<vector<LinkedList<T>*> > > payoffMatrix;
 		
+		// the payoff lists and their nodes, freed all at once with the game (nodes first, so they're destroyed last)
+		NodePool<ListNode<T> > nodePool;
+		NodePool<LinkedList<T> > listPool;
+		
 		// k-rationalizability 
 		vector<vector<vector<vector<int> > > > kMatrix;
 		vector<double> rationalityProbabilities = vector<double>(4); // probability a player is L_i, i = 0,...3
@@ -35,12 +50,27 @@ class simGame
 		bool impartial;
 		bool mixed;
 		
+		/*
+			analysis cache: a result is valid while its version matches the game's. 
+			Editing P_x's payoffs only invalidates P_x's best responses; 
+			changing the shape of the game invalidates everything.
+		*/
+		unsigned long version;
+		vector<unsigned long> payoffVersions; // version at which P_x's payoffs last changed
+		vector<unsigned long> bestResponseVersions;
+		unsigned long equilibriaVersion;
+		unsigned long paretoVersion; // paretoPureEquilibria, which depend on every outcome
+		unsigned long typeVersion;
+		unsigned long kStrategiesVersion;
+		unsigned long contentHashVersion;
+		unsigned long long contentHashValue;
+		
 		vector<vector<int> > maxBestResponseLengths();
 		vector<vector<int> > maxPayoffLengths();
 		// vector<vector<int> > maxEntryLengths(vector<vector<vector<bool> > >);
 		int entryBestResponseLengths(int, int, int);
 		int entryPayoffLengths(int, int, int);
-		int entryLength(vector<vector<vector<bool> > >, int, int, int);
+		int entryLength(const vector<vector<vector<bool> > > &, int, int, int);
 		void clearPureEquilibria() { pureEquilibria.clear(); }
 		void clearParetoPureEquilibria() { paretoPureEquilibria.clear(); }
 		void pushKOutcomeProbabilities() { outcomeProbabilities.push_back(0.0); }
@@ -49,19 +79,18 @@ class simGame
 		bool getBOS() 												{ return bos; }
 		bool getIH() 												{ return ih; }
 		bool getImpartial() 										{ return impartial; }
-		vector<int> getKOutcome(int i) 								{ return kOutcomes.at(i); }
-		vector<int> getKStrategy(int i) 							{ return kStrategies.at(i); }
+		const vector<int>& getKOutcome(int i) const 				{ return kOutcomes.at(i); }
+		const vector<int>& getKStrategy(int i) const 				{ return kStrategies.at(i); }
 		int getMaxRationality() 									{ return maxR; }
 		int getNumOutcomes() const 									{ return numOutcomes; }
-		int getNumPlayers() const 									{ return numPlayers; }
 		double getOutcomeProbability(int i) 						{ return outcomeProbabilities.at(i); }
-		vector<int> getParetoEquilibrium(int i) 					{ return paretoPureEquilibria.at(i); }
-		vector<vector<int> > getParetoPureEquilibria() 				{ return paretoPureEquilibria; }
-		vector<vector<vector<LinkedList<T>*> > > getPayoffMatrix()	{ return payoffMatrix; }
+		const vector<int>& getParetoEquilibrium(int i) const 		{ return paretoPureEquilibria.at(i); }
+		const vector<vector<int> >& getParetoPureEquilibria() const	{ return paretoPureEquilibria; }
+		const vector<vector<vector<LinkedList<T>*> > >& getPayoffMatrix() const	{ return payoffMatrix; }
 		bool getPC() 												{ return pc; }
 		bool getPD() 												{ return pd; }
-		vector<vector<int> > getPureEquilibria() 					{ return pureEquilibria; }
-		vector<int> getPureEquilibrium(int i)						{ return pureEquilibria.at(i); }
+		const vector<vector<int> >& getPureEquilibria() const		{ return pureEquilibria; }
+		const vector<int>& getPureEquilibrium(int i) const			{ return pureEquilibria.at(i); }
 		double getRationalityProbability(double i)					{ return rationalityProbabilities.at(i); }
 		
 		bool getSH() 												{ return sh; }
@@ -70,9 +99,9 @@ class simGame
 		int getSizeParetoPureEquilibria() 							{ return paretoPureEquilibria.size(); }
 		int getSizePureEquilibria() 								{ return pureEquilibria.size(); }
 		bool getZS() 												{ return zs; }
-		void pushKOutcome(vector<int> temp) 						{ kOutcomes.push_back(temp); }
-		void pushEquilibrium(vector<int> temp) 						{ pureEquilibria.push_back(temp); }
-		void pushParetoEquilibrium(vector<int> temp) 				{ paretoPureEquilibria.push_back(temp); }
+		void pushKOutcome(const vector<int> &temp) 					{ kOutcomes.push_back(temp); }
+		void pushEquilibrium(const vector<int> &temp) 				{ pureEquilibria.push_back(temp); }
+		void pushParetoEquilibrium(const vector<int> &temp) 		{ paretoPureEquilibria.push_back(temp); }
 		void setBOS(bool val) 										{ bos = val; }
 		void setChicken(bool val) 									{ chicken = val; }
 		void setIH(bool val) 										{ ih = val; }
@@ -88,69 +117,85 @@ class simGame
 		void setZS(bool val) 										{ zs = val; }
 		
 		void addStrategy(int);
-		bool allEqualEquilibria();
-		bool bosCondition(vector<int>, vector<int>);
 		void changeAPayoff(int);
 		void changePayoffs(int);
-		bool checkBOSConditions();		
-		bool checkChickenConditions();
-		bool checkIHConditions();	
-		bool checkNullCondition();
-		bool checkPDConditions();
-		bool checkSHConditions();
-		bool checkZSConditions();
-		bool chickenCondition(vector<int>, vector<int>);
+		BitMatrix choiceKnowledgeRelation() const;
 		void computeBestResponses();
 		void computeChoices();
 		vector<vector<Polynomial*> > computeExpectedUtilities();
 		void computeImpartiality();
+		bool computeInformedChoices(vector<int> &, vector<int> &);
 		void computeKStrategies();
 		void computeNumOutcomes();
 		void computePureEquilibria();
-		bool coordination();
 		void determineType();
+		void evaluatePattern(const vector<bool> &, const vector<int> &, const vector<int> &, map<int, bool> &, CommunicationOutcome &);
 		vector<int> enterStratProfile();
-		bool equalEquilibria(int, int);
+		vector<string> exactPayoffs();
 		vector<vector<vector<bool> > > extraSpacesInColumns();
-		int hash(vector<int>);
+		int hash(const vector<int> &);
+		static void hashBytes(unsigned long long &, const void*, int);
+		static void hashPayoff(unsigned long long &, const T &, true_type);
+		static void hashPayoff(unsigned long long &, const T &, false_type);
 		bool isInferior();
 		void isMixed();
-		bool isPureEquilibrium(vector<int>);
+		bool isPureEquilibrium(const vector<int> &);
 		bool isStrictlyDominant(int, int);
 		bool isStrictlyDominated(int, int);
 		bool isWeaklyDominant(int, int);
 		bool isWeaklyDominated(int, int);
-		int maxPayoffInRowColOrMatrices(int, vector<int>);
+		bool lessThanProfile(const vector<int> &, const vector<int> &);
+		int maxPayoffInRowColOrMatrices(int, const vector<int> &);
 		int maxStratInRowColOrMatrices(int, vector<int>);
 		int maxStrat(int);
+		int opponentsIndex(int, const vector<int> &);
+		template <typename N> vector<vector<N> > payoffSlice(int);
 		void printKOutcomes();
 		void printKOutcomeProbabilities();
 		void printKProbabilities();
 		void printKStrategies();
 		void printPayoffMatrixSansInfo();
 		void properDominantStrategies();
-		bool PO(vector<int>);
+		void payoffsChanged(int);
+		bool PO(const vector<int> &);
 		void randType();
 		// void removePlayer();
 		void removeStrategy(int, int);
 		void removeStrategyPrompt(int);
-		int rHash(vector<int>);
+		void reshape(const vector<int> &, const vector<vector<int> > &);
+		void reshape(const vector<int> &, const vector<int> &);
+		int rHash(const vector<int> &);
 		vector<int> rUnhash(int matrixIndex);
-		void saveKMatrixAsLatex(vector<int>, vector<double>);
-		bool shCondition(vector<int>, vector<int>);
+		void saveKMatrixAsLatex(const vector<int> &, const vector<double> &);
+		void shapeChanged();
+		void updateBestResponses(int, vector<int>);
 		double solve(Polynomial*, Polynomial*);
 		vector<int> unhash(int);
+		void unhash(int, vector<int> &);
 	public:
 		Player* getPlayer(int i) const { return players.at(i); }
+		int getNumPlayers() const { return numPlayers; }
 	
 		simGame(int);
 		~simGame();
 		void addPlayer();
 		bool commonKnowledge() const;
 		void communication();
-		void computeMixedEquilibria();
+		BitMatrix computeKnowledgeClosure() const;
+		int computeKnowledgeRounds() const;
+		void computeMixedEquilibria(bool exact = false);
+		CanonicalForm computeCanonicalForm();
+		GameFeatures<T> computeFeatures();
 		void computeMixedStrategies();
+		unsigned long long contentHash();
+		template <typename N> bool computeSecurityStrategy(int, vector<N> &, N &, N);
+		template <typename N> bool computeZeroSumSolution(vector<vector<N> > &, N &, N);
 		void editPlayer();		
+		bool evaluateCommunication(vector<CommunicationOutcome> &);
+		bool evaluateCommunication(const vector<vector<int> > &, vector<CommunicationOutcome> &);
+		unsigned long getVersion() const { return version; }
+		bool loadAnalysis(const AnalysisCache &);
+		bool mutualKnowledge() const;
 		void printBestResponses();
 		void printBothSeparately();
 		void printKMatrix();
@@ -159,13 +204,23 @@ class simGame
 		void printPlayer() const;
 		void printPlayers() const;
 		void printPureEquilibria();
+		void printZeroSumSolution(bool exact = false);
 		void randGame();
-		void readFromFile();
+		void readFromFile(AnalysisCache* cache = NULL);
 		void reduce();
 		void savePayoffMatrixAsLatex();
 		void saveToFile();
 		void setAllNumStrats(char);
+		void setAllNumStrats(const vector<int> &);
 		void setAllRationalities();
+		void setPayoff(const vector<int> &, int, T);
+		void storeAnalysis(AnalysisCache &);
+		void writeBestResponses(ResultWriter &);
+		void writeExpectedUtilities(ResultWriter &);
+		void writeKStrategies(ResultWriter &);
+		void writePlayers(ResultWriter &) const;
+		void writePureEquilibria(ResultWriter &);
+		void writeResults(ResultWriter &);
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -247,7 +302,7 @@ simGame<T>::simGame(int nP)
 			payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats());
 			for(int j = 0; j < players.at(1)->getNumStrats(); j++) // each column in row i
 			{
-				LinkedList<T>* newList = new LinkedList<T>; // should already have head and tail
+				LinkedList<T>* newList = listPool.create(&nodePool); // should already have head and tail
 				for (int x = 0; x < numPlayers; x++)
 					newList->appendNode(0, false);
 				payoffMatrix.at(m).at(i).at(j) = newList; // head is the first node of the list in payoffMatrix.at(0).at(i).at(j)
@@ -263,6 +318,16 @@ simGame<T>::simGame(int nP)
 	sh = false;
 	null = false;
 	
+	version = 1;
+	payoffVersions = vector<unsigned long>(numPlayers, version);
+	bestResponseVersions = vector<unsigned long>(numPlayers, 0);
+	equilibriaVersion = 0;
+	paretoVersion = 0;
+	typeVersion = 0;
+	kStrategiesVersion = 0;
+	contentHashVersion = 0;
+	contentHashValue = 0;
+	
 	isMixed();
 }
 
@@ -272,11 +337,8 @@ simGame<T>::~simGame()
 {
 	for (int x = 0; x < numPlayers; x++)
 		delete players.at(x);
-		
-	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-		for(int i = 0; i < players.at(0)->getNumStrats(); i++) // each row
-			for(int j = 0; j < players.at(1)->getNumStrats(); j++) // each column in row i
-				delete payoffMatrix.at(m).at(i).at(j);
+	
+	// listPool and nodePool free the payoff lists in bulk
 }
 
 // add Player and set attributes
@@ -288,6 +350,10 @@ void simGame<T>::addPlayer()
 	// int nT = -1, nV = 1;
 	LinkedList<T>* curList; 
 	Polynomial* p;
+	vector<int> oldNumStrats = vector<int>(numPlayers);
+	
+	for (int x = 0; x < numPlayers; x++)
+		oldNumStrats.at(x) = players.at(x)->getNumStrats();
 	
 	// cout << "\nUtility: ";
 	// cin >> u;
@@ -335,22 +401,11 @@ void simGame<T>::addPlayer()
 	players.at(numPlayers) = newPlayer; // player added
 	numPlayers++;
 	
-	// create new matrices in payoffMatrix
+	// the new player is last, so the old outcomes stay in the first matrices as the ones where they play s_1
 	int oldSize = payoffMatrix.size();
-	payoffMatrix.resize(oldSize * players.at(numPlayers - 1)->getNumStrats()); // (n3 * n4 * ... * n_{old nP}) * n_{new player}
-	for (int m = oldSize; (unsigned)m < payoffMatrix.size(); m++)
-	{
-		payoffMatrix.at(m).resize(players.at(0)->getNumStrats());
-		for(int i = 0; i < players.at(0)->getNumStrats(); i++) // each row
-		{
-			payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats()); // 2D slice is now correct size
-			for(int j = 0; j < players.at(1)->getNumStrats(); j++) // each column in row i
-			{
-				LinkedList<T>* newList = new LinkedList<T>();
-				payoffMatrix.at(m).at(i).at(j) = newList; // head is the first node of the list in payoffMatrix.at(0).at(i).at(j)
-			}
-		}
-	}
+	vector<int> newNumStrats = oldNumStrats;
+	newNumStrats.push_back(nS);
+	reshape(oldNumStrats, newNumStrats);
 	
 	int val = -1;
 	vector<int> profile = vector<int>(numPlayers);
@@ -360,17 +415,12 @@ void simGame<T>::addPlayer()
 	cout << "P_" << numPlayers << ":\n";
 	for (int m = 0; m < oldSize; m++)
 	{
-		profile = unhash(m);
+		unhash(m, profile);
 		for(int i = 0; i < players.at(0)->getNumStrats(); i++)
 			for(int j = 0; j < players.at(1)->getNumStrats(); j++)
 			{
 				profile.at(0) = i;
 				profile.at(1) = j;
-				if (!payoffMatrix.at(m).at(i).at(j))
-				{							
-					LinkedList<T>* newList = new LinkedList<T>;
-					payoffMatrix.at(m).at(i).at(j) = newList;
-				}
 				curList = payoffMatrix.at(m).at(i).at(j);
 				cout << "\t(";
 				for (int x = 0; x < numPlayers; x++)
@@ -381,7 +431,7 @@ void simGame<T>::addPlayer()
 				}
 				cout << "):  ";
 				cin >> val;
-				curList->appendNode(val, false);
+				curList->setNodeValue(numPlayers - 1, val);
 			}
 	}
 	
@@ -389,7 +439,7 @@ void simGame<T>::addPlayer()
 	cout << "Enter the payoffs for all players in the new outcomes.\n";
 	for (int m = oldSize; (unsigned)m < payoffMatrix.size(); m++)
 	{
-		profile = unhash(m);
+		unhash(m, profile);
 		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
 			for (int j = 0; j < players.at(1)->getNumStrats(); j++)
 			{
@@ -404,20 +454,12 @@ void simGame<T>::addPlayer()
 						cout << ", ";
 				}
 				cout << "):\n";
-				if (!payoffMatrix.at(m).at(i).at(j))
-				{							
-					LinkedList<T>* newList = new LinkedList<T>();
-					payoffMatrix.at(m).at(i).at(j) = newList;
-				}
 				curList = payoffMatrix.at(m).at(i).at(j);
 				for (int x = 0; x < numPlayers; x++)
 				{
 					cout << "\tP_" << x + 1 << ":  ";
 					cin >> val;
-					if (curList->getSize() < numPlayers)
-						curList->appendNode(val, false);
-					else
-						curList->setNodeValue(x, val);
+					curList->setNodeValue(x, val);
 				}
 			}
 	}
@@ -430,59 +472,27 @@ void simGame<T>::addStrategy(int x)
 {	
 	int val = -1;
 	LinkedList<T>* curList;
+	vector<int> oldNumStrats = vector<int>(numPlayers);
 	vector<int> profile = vector<int>(numPlayers);
 
-	players.at(x)->setNumStrats(players.at(x)->getNumStrats() + 1); // increase the player's number of strategies
+	for (int y = 0; y < numPlayers; y++)
+		oldNumStrats.at(y) = players.at(y)->getNumStrats();
+	vector<int> newNumStrats = oldNumStrats;
+	newNumStrats.at(x)++;
+	reshape(oldNumStrats, newNumStrats);
+	
 	cout << "Enter the payoffs for all players in the new outcomes:\n";
-	if (x == 0)
-	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-		{
-			profile = unhash(m);
-			// add a new row to each matrix and set the size of each new row
-			payoffMatrix.at(m).resize(payoffMatrix.at(m).size() + 1);
-			payoffMatrix.at(m).at(players.at(x)->getNumStrats() - 1).resize(players.at(1)->getNumStrats());
-			
-			for (int j = 0; j < players.at(1)->getNumStrats(); j++) // add new lists to each new row
-			{				
-				LinkedList<T>* newList = new LinkedList<T>;
-				profile.at(0) = players.at(x)->getNumStrats() - 1;
-				profile.at(1) = j;
-				
-				cout << "(";
-				for (int y = 0; y < numPlayers; y++)
-				{
-					cout << profile.at(y) + 1;
-					if (y < numPlayers - 1)
-						cout << ", ";
-				}
-				cout << "):\n";
-				payoffMatrix.at(m).at(players.at(x)->getNumStrats() - 1).at(j) = newList;
-				curList = payoffMatrix.at(m).at(players.at(x)->getNumStrats() - 1).at(j);
-				for (int y = 0; y < numPlayers; y++)
-				{
-					cout << "\tP_" << y + 1 << ":  ";
-					cin >> val;
-					curList->appendNode(val, false);
-				}
-			}
-		}
-	}
-	else if (x == 1)
+	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
 	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+		unhash(m, profile);
+		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
 		{
-			profile = unhash(m);
-			// add a new row to each matrix and set the size of each new row
-			payoffMatrix.at(m).resize(payoffMatrix.at(m).size() + 1);
-			
-			for (int i = 0; i < players.at(0)->getNumStrats(); i++) // add new lists to each new column
+			for (int j = 0; j < players.at(1)->getNumStrats(); j++)
 			{
-				payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats());
-				
-				LinkedList<T>* newList = new LinkedList<T>;
 				profile.at(0) = i;
-				profile.at(1) = players.at(x)->getNumStrats() - 1;
+				profile.at(1) = j;
+				if (profile.at(x) != newNumStrats.at(x) - 1)
+					continue;
 				
 				cout << "(";
 				for (int y = 0; y < numPlayers; y++)
@@ -492,115 +502,19 @@ void simGame<T>::addStrategy(int x)
 						cout << ", ";
 				}
 				cout << "):\n";
-				payoffMatrix.at(m).at(i).at(players.at(x)->getNumStrats() - 1) = newList;
-				curList = payoffMatrix.at(m).at(i).at(players.at(x)->getNumStrats() - 1);
+				curList = payoffMatrix.at(m).at(i).at(j);
 				for (int y = 0; y < numPlayers; y++)
 				{
 					cout << "\tP_" << y + 1 << ":  ";
 					cin >> val;
-					curList->appendNode(val, false);
+					curList->setNodeValue(y, val);
 				}
 			}
 		}
 	}
-	else // x >= 2
-	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-		{
-			profile = unhash(m);
-			if (profile.at(x) == players.at(x)->getNumStrats() - 2) // - 2 because we already incremented numStrats at the beginning
-			{
-				// create and insert new matrix
-				vector<vector<LinkedList<T>*> > newMatrix = vector<vector<LinkedList<T>*> >(players.at(0)->getNumStrats());
-				for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-					newMatrix.at(i).resize(players.at(1)->getNumStrats());
-				if ((unsigned)m == payoffMatrix.size() - 1)
-					payoffMatrix.push_back(newMatrix);
-				else
-					payoffMatrix.insert(payoffMatrix.begin() + m + 1, newMatrix);
-				
-				// enter values into new matrix m + 1
-				for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-				{
-					for (int j = 0; j < players.at(1)->getNumStrats(); j++) // add new lists to each new row
-					{				
-						profile.at(0) = i;
-						profile.at(1) = j;
-						
-						cout << "\t(";
-						for (int y = 0; y < numPlayers; y++)
-						{
-							if (y == x)
-								cout << profile.at(y) + 2;
-							else
-								cout << profile.at(y) + 1;
-							if (y < numPlayers - 1)
-								cout << ", ";
-						}
-						cout << "):\n";
-						
-						LinkedList<T>* newList = new LinkedList<T>;
-						payoffMatrix.at(m + 1).at(i).at(j) = newList;
-						curList = payoffMatrix.at(m + 1).at(i).at(j);
-						for (int y = 0; y < numPlayers; y++)
-						{
-							cout << "\t\tP_" << y + 1 << ":  ";
-							cin >> val;
-							curList->appendNode(val, false);
-						}
-					}
-				}
-				m = m + 2; // skip the matrix we just entered
-				}
-		}
-	}
-	if (impartial)
-		impartial = false;
-	
 	printPayoffMatrix();
 }
 
-// check if all equilibria are equal
-template <typename T>
-bool simGame<T>::allEqualEquilibria()
-{	
-	// checking for IH, PD, PC
-	for (int a = 0; a < this->getSizePureEquilibria(); a++) // equilibrium being checked
-		for (int b = 0; b < numPlayers; b++)
-			for (int i = a + 1; i < this->getSizePureEquilibria(); i++) // only need to compare with equilibria past the ones that have been checked
-				for (int j = 0; j < numPlayers; j++) // equilibrium being compared
-				{
-					if (!equalEquilibria(a, i))
-						return false;
-				}
-	return true;
-}
-
-// Battle of Sexes relation between equilibria
-template <typename T>
-bool simGame<T>::bosCondition(vector<int> eq1, vector<int> eq2)
-{
-	int X = payoffMatrix.at(hash(eq1)).at(eq1.at(0)).at(eq1.at(1))->getNodeValue(0);
-	int Y = payoffMatrix.at(hash(eq1)).at(eq1.at(0)).at(eq1.at(1))->getNodeValue(1);
-	int W = payoffMatrix.at(hash(eq2)).at(eq2.at(0)).at(eq2.at(1))->getNodeValue(0);
-	int Z = payoffMatrix.at(hash(eq2)).at(eq2.at(0)).at(eq2.at(1))->getNodeValue(1);
-	
-	/*
-		  A  |  B
-	A | X, Y | U, U
-	B | V, V | W, Z
-	U < Y \le W < Z \le X
-	or
-	W \le Y < Z \le X
-	I.e., Y,W < X,Z; 
-	i.e., U < W < X and U < Y < Z
-	*/
-	if ((W < X && Y < Z) || (X < W && Z < Y))
-		return true;
-	else
-		return false;
-}
-
 // change an individual payoff
 template <typename T>
 void simGame<T>::changeAPayoff(int x)
@@ -622,6 +536,11 @@ void simGame<T>::changeAPayoff(int x)
 	cin >> val;
 	curList = payoffMatrix.at(0).at(firstStrat - 1).at(secondStrat - 1);
 	curList->setNodeValue(x, val);
+	
+	vector<int> profile = unhash(0);
+	profile.at(0) = firstStrat - 1;
+	profile.at(1) = secondStrat - 1;
+	updateBestResponses(x, profile);
 }
 
 // change all payoffs for a player
@@ -630,6 +549,7 @@ void simGame<T>::changePayoffs(int x)
 {
 	int val = -1;
 	LinkedList<T>* curList;
+	vector<int> profile = unhash(0);
 	
 	cout << "Enter the new payoffs for P_" << x + 1 << ".\n";
 	for (int i = 0; i < players.at(0)->getNumStrats(); i++)
@@ -640,307 +560,36 @@ void simGame<T>::changePayoffs(int x)
 			cout << "(s_" << i + 1 << ", s_" << j + 1 << "): ";
 			cin >> val;
 			curList->setNodeValue(x, val);
+			
+			profile.at(0) = i;
+			profile.at(1) = j;
+			updateBestResponses(x, profile);
 		}
 }
 
-// checks if Battle of Sexes using bosCondition
-/************************************************************************
-at least 2 PO equilibria
-player prefers an equilibrium different from what the other players want
-************************************************************************/
-/*
-	  A  |  B
-A | X, Y | U, U
-B | V, V | W, Z
-V \le U < Y \le W < Z \le X
-or
-W \le Y < Z \le X
-I.e., Y,W < X,Z; i.e., U < W < X and U < Y < Z
-*/
-template <typename T>
-bool simGame<T>::checkBOSConditions()
-{
-	if (getSizePureEquilibria() != 2 || getSizePureEquilibria() != getSizeParetoPureEquilibria())
-		return false;
-	
-	if (!coordination())
-		return false;
-	
-	for (int i = 0; i < getSizePureEquilibria(); i++)
-		for (int j = i + 1; j < getSizePureEquilibria(); j++) // only need to compare with equilibria past the ones that have been checked
-		{
-			if (!bosCondition(getPureEquilibrium(i), getPureEquilibrium(j)))
-				return false;
-		}
-	
-	return true;
-}
-
-// checks if Chicken using chickenCondition
-template <typename T>
-bool simGame<T>::checkChickenConditions()
-{
-	LinkedList<T>* curList;
-	LinkedList<T>* checkList;
-	
-	if (getSizePureEquilibria() <= 1 || getSizeParetoPureEquilibria() <= 1 || getSizePureEquilibria() != 2)
-		return false;
-
-	if (coordination())
-		return false;
-	
-	// same condition as BOS
-	for (int i = 0; i < this->getSizePureEquilibria(); i++)
-		for (int j = i + 1; j < this->getSizePureEquilibria(); j++) // only need to compare with equilibria past the ones that have been checked
-		{
-			if (!chickenCondition(getPureEquilibrium(i), getPureEquilibrium(j)))
-				return false;
-		}
-	
-	// ensures diagonal entries aren't equal
-	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-			for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-			{
-				curList = payoffMatrix.at(m).at(i).at(j);
-				for (int a = i + 1; a < players.at(0)->getNumStrats(); a++)
-				{
-					for (int b = j + 1; b < players.at(1)->getNumStrats(); b++)
-					{
-						checkList = payoffMatrix.at(m).at(a).at(b);
-						if (i == j && a == b && curList->getNodeValue(0) == checkList->getNodeValue(0) && curList->getNodeValue(1) == checkList->getNodeValue(1))
-							return false;
-					}
-				}
-			}
-	
-	return true;
-}
-
-// checks if Invisible Hand using ihCondition
-/********************************************************
-at least 1 PO equilibrium
-all equal if more than one
-any nonequal equilibria are non-PO
-each player has a dominant strategy for a PO equilibrium
-********************************************************/
-template <typename T>
-bool simGame<T>::checkIHConditions() // TEST: ktest6.txt gives IH
-{
-	if (getSizePureEquilibria() != 1 || getSizePureEquilibria() != getSizePureEquilibria())
-		return false;
-	
-	vector<int> eq = vector<int>(numPlayers);
-	
-	if (null)
-		return false;
-	
-	for (int i = 0; i < getSizePureEquilibria(); i++)
-	{
-		eq = getPureEquilibrium(i);
-		if (!PO(eq))
-			return false;
-		
-		for (int x = 0; x < numPlayers; x++)
-		{
-			if (!isStrictlyDominant(x, eq.at(x)))
-				return false;
-		}
-	}
-	return true;
-}
-
-// checks if Null game
+// P_x knows P_y's choice, taken from row x of P_x's own knowledge
 template <typename T>
-bool simGame<T>::checkNullCondition()
+BitMatrix simGame<T>::choiceKnowledgeRelation() const
 {
-	int factor = -1;
-	LinkedList<T>* curList;
-
-	computeNumOutcomes();
-	
-	if (getSizePureEquilibria() != numOutcomes)
-		return false;
+	BitMatrix relation = BitMatrix::identity(numPlayers);
 	
 	for (int x = 0; x < numPlayers; x++)
 	{
-		factor = payoffMatrix.at(0).at(0).at(0)->getNodeValue(x);
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-			for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-				for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-				{					
-					curList = payoffMatrix.at(m).at(i).at(j);
-					if (curList->getNodeValue(x) != factor)
-						return false;
-				}
-		
-	}
-	return true;
-}
-
-// checks if Prisoner's Dilemma using pdCondition
-/************************************************************
-at least 1 non-PO equilibrium
-all equal if more than one
-each player has a dominant strategy for a non-PO equilibrium
-************************************************************/
-template <typename T>
-bool simGame<T>::checkPDConditions()
-{
-	vector<int> eq = vector<int>(numPlayers);
-	
-	if (getSizePureEquilibria() <= 0 || getSizePureEquilibria() <= getSizeParetoPureEquilibria())
-		return false;
-	
-	for (int i = 0; i < getSizePureEquilibria(); i++)
-	{
-		eq = getPureEquilibrium(i);
-		if (PO(eq))
-			return false;
-		for (int x = 0; x < numPlayers; x++)
-		{			
-			if (!isWeaklyDominant(x, eq.at(x)))
-				return false;
-		}
-	}
-	return true;
-}
-
-// checks if Stag Hunt using shCondition
-/************************************************************************************************************
-at least 1 PO equilibrium and at least 1 non-PO equilibrium
-each player is guaranteed a non-optimal payoff for choosing the strategy corresponding to the non-PO outcome
-*************************************************************************************************************/
-/*
-	  A  |  B
-A | X, Y | U, Z
-B | W, V | W, Z
-W \le Z < X \le Y
-...
-I.e., W,Z < X,Y; i.e., U < W < X and V < Z < Y
-*/
-template <typename T>
-bool simGame<T>::checkSHConditions()
-{
-	if (getSizePureEquilibria() <= 1 || getSizeParetoPureEquilibria() <= 0 || getSizePureEquilibria() <= getSizeParetoPureEquilibria())
-		return false;
-	
-	if(!coordination())
-		return false;
-	
-	for (int i = 0; i < this->getSizePureEquilibria(); i++)
-	{
-		for (int j = i + 1; j < this->getSizePureEquilibria(); j++) // only need to compare with equilibria past the ones that have been checked
-		{
-			if (equalEquilibria(i, j) || !shCondition(getPureEquilibrium(i), getPureEquilibrium(j)))
-				return false;
-		}
+		const BitMatrix &own = players.at(x)->getKnowledge()->getChoiceMatrix();
+		if (own.getSize() == numPlayers)
+			relation.setRow(x, own.getRow(x));
 	}
-	return true;
+	return relation;
 }
 
-// All outcomes are PO
-template <typename T>
-bool simGame<T>::checkZSConditions()
-{	
-	vector<int> profile = vector<int>(numPlayers);
-	
-	if (null)
-		return false;
-	
-	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-	{
-		profile = unhash(m); // first two are -1
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++) // outcome being checked
-			for (int j = 0; j < players.at(1)->getNumStrats(); j++) // ^
-			{				
-				profile.at(0) = i;
-				profile.at(1) = j;
-				if (!PO(profile))
-					return false;
-			}
-	}
-	return true;
-}
-
-// Chicken relation between equilibria
-template <typename T>
-bool simGame<T>::chickenCondition(vector<int> eq1, vector<int> eq2)
-{
-	int X = payoffMatrix.at(0).at(eq1.at(0)).at(eq1.at(1))->getNodeValue(0);
-	int Y = payoffMatrix.at(0).at(eq1.at(0)).at(eq1.at(1))->getNodeValue(1);
-	int W = payoffMatrix.at(0).at(eq2.at(0)).at(eq2.at(1))->getNodeValue(0);
-	int Z = payoffMatrix.at(0).at(eq2.at(0)).at(eq2.at(1))->getNodeValue(1);
-	
-	if (X > W)
-	{
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-		{			
-			if (i != eq1.at(0) && i != eq2.at(0))
-			{
-				// U < W < X, V < Y < Z
-				if (payoffMatrix.at(0).at(i).at(eq2.at(1))->getNodeValue(0) == W || payoffMatrix.at(0).at(i).at(eq1.at(1))->getNodeValue(1) == Y)
-					return false;
-			}
-		}
-		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-		{
-			if (j != eq1.at(1) && j != eq2.at(1))
-			{
-				// U < Y < Z, V < W < X
-				if (payoffMatrix.at(0).at(eq1.at(0)).at(j)->getNodeValue(1) == Y || payoffMatrix.at(0).at(eq2.at(0)).at(j)->getNodeValue(0) == W)
-					return false;
-			}
-		}
-	}
-	else
-	{
-		// U < Z < Y, V < X < W
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-		{
-			if (payoffMatrix.at(0).at(i).at(eq2.at(1))->getNodeValue(1) == Z || payoffMatrix.at(0).at(i).at(eq1.at(1))->getNodeValue(0) == X)
-			return false;
-		}
-		
-		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-		{
-			// U < X < W, V < Z < Y
-			if (payoffMatrix.at(0).at(eq1.at(0)).at(j)->getNodeValue(0) == X || payoffMatrix.at(0).at(eq2.at(0)).at(j)->getNodeValue(1) == Z)
-				return false;
-		}
-		
-	}
-	
-	/*
-	  |   A  |  B
-	A | U, U | W, Z
-	B | X, Y | V, V
-	V < U < Y \le W < Z \le X
-	or
-	W \le Y < Z \le X
-	I.e., Y,W < X,Z; i.e., U < W < X and U < Y < Z
-	U < Y, U < W, V < X, V < Z
-	*/
-	if ((W < X && Y < Z) || (X < W && Z < Y))
-		return true;
-	else
-		return false;
-}
-
-// checks if common knowledge
+// checks if common knowledge: every player knows that everyone knows every choice
 template <typename T>
 bool simGame<T>::commonKnowledge() const
 {
 	for (int x = 0; x < numPlayers; x++)
 	{
-		for (int y = 0; y < numPlayers; y++)
-		{
-			for (int z = 0; z < numPlayers; z++)
-			{
-				if (!players.at(x)->getKnowledge()->getchoiceKnowledge(y, z))
-					return false;
-			}
-		}
+		if (!players.at(x)->getKnowledge()->getChoiceMatrix().isFull())
+			return false;
 	}
 	return true;
 }
@@ -1089,11 +738,14 @@ void simGame<T>::communication()
 template <typename T>
 void simGame<T>::computeBestResponses()
 {
-	int maxValue = -std::numeric_limits<int>::max();
+	T maxValue = -std::numeric_limits<int>::max();
 	LinkedList<T>* curList;
 	
 	for (int x = 0; x < numPlayers; x++)
 	{
+		if (bestResponseVersions.at(x) == payoffVersions.at(x))
+			continue; // P_x's payoffs haven't changed since their best responses were found
+		
 		if (x == 0)
 		{
 			for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
@@ -1146,12 +798,12 @@ void simGame<T>::computeBestResponses()
 		}
 		else // x > 1
 		{
-			int m = 0;
-			int product = 1;
 			vector<int> profile = vector<int>(numPlayers);
-			while ((unsigned)m < payoffMatrix.size())
+			for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
 			{
-				profile = unhash(m);
+				unhash(m, profile);
+				if (profile.at(x) > 0)
+					continue; // each section is checked once, from the matrix where P_x plays s_1
 				for (int i = 0; i < players.at(0)->getNumStrats(); i++)
 					for (int j = 0; j < players.at(1)->getNumStrats(); j++)
 					{						
@@ -1182,19 +834,9 @@ void simGame<T>::computeBestResponses()
 							profile.at(x)++; // move to next matrix in section
 						}
 					}
-				
-				// m = hash(profile);
-				// profile.at(x)--; // will be exactly numStrats at end, so decrement
-				// m = hash(profile); // at last matrix in section
-				
-				if (x > 2 && x < numPlayers - 1 && product == 1)
-				{
-					for (int y = 2; y <= x - 1; y++)
-						product *= players.at(y)->getNumStrats();
-				}
-				m += product;
 			}
 		}
+		bestResponseVersions.at(x) = payoffVersions.at(x);
 	}
 }
 
@@ -1256,6 +898,25 @@ void simGame<T>::computeChoices()
 				players.at(x)->setChoice(choices.at(x));
 		}
 	}
+	else if (zs && numPlayers == 2)
+	{
+		// each player chooses the strategy played most often in their optimal mixed strategy
+		vector<vector<double> > strategies;
+		double value;
+		if (computeZeroSumSolution(strategies, value, 1e-9))
+		{
+			for (int x = 0; x < numPlayers; x++)
+			{
+				int maxS = 0;
+				for (int s = 1; (unsigned)s < strategies.at(x).size(); s++)
+				{
+					if (strategies.at(x).at(s) > strategies.at(x).at(maxS))
+						maxS = s;
+				}
+				players.at(x)->setChoice(maxS);
+			}
+		}
+	}
 	else
 	{
 		if (zs)
@@ -1320,7 +981,7 @@ vector<vector<Polynomial*> > simGame<T>::computeExpectedUtilities()
 					for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
 					{
 						// Get Coefficients
-						profile = unhash(m);
+						unhash(m, profile);
 						profile.at(x) = std::numeric_limits<T>::quiet_NaN();
 						for (int j = 0; j < players.at(1)->getNumStrats(); j++)
 						{
@@ -1350,7 +1011,7 @@ vector<vector<Polynomial*> > simGame<T>::computeExpectedUtilities()
 					coeffs.resize(players.at(0)->getNumStrats() * payoffMatrix.size()); // coefficients for P_x's expected utilities
 					for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
 					{
-						profile = unhash(m);
+						unhash(m, profile);
 						profile.at(x) = std::numeric_limits<T>::quiet_NaN();
 						for (int i = 0; i < players.at(0)->getNumStrats(); i++)
 						{
@@ -1402,7 +1063,7 @@ vector<vector<Polynomial*> > simGame<T>::computeExpectedUtilities()
 					count = 0;
 					while (count < numMatricesInSection)
 					{
-						profile = unhash(m);
+						unhash(m, profile);
 						profile.at(x) = strat;
 						for (int i = 0; i < players.at(0)->getNumStrats(); i++)
 							for (int j = 0; j < players.at(1)->getNumStrats(); j++) // terms
@@ -1463,6 +1124,36 @@ vector<vector<Polynomial*> > simGame<T>::computeExpectedUtilities()
 	}
 }
 
+// ordinal canonical form, for deduplicating isomorphic games and caching results by class
+template <typename T>
+CanonicalForm simGame<T>::computeCanonicalForm()
+{
+	return CanonicalForm(computeFeatures());
+}
+
+// flatten the payoffs in one pass and compute the game's feature vector
+template <typename T>
+GameFeatures<T> simGame<T>::computeFeatures()
+{
+	vector<int> numStrats = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+		numStrats.at(x) = players.at(x)->getNumStrats();
+	
+	// payoffMatrix.at(m).at(i).at(j) is outcome i + n_1 * j + n_1 * n_2 * m
+	int sliceSize = numStrats.at(0) * numStrats.at(1);
+	vector<T> payoffs = vector<T>(payoffMatrix.size() * sliceSize * numPlayers);
+	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+		for (int i = 0; i < numStrats.at(0); i++)
+			for (int j = 0; j < numStrats.at(1); j++)
+			{
+				int o = sliceSize * m + numStrats.at(0) * j + i;
+				for (int x = 0; x < numPlayers; x++)
+					payoffs.at(o * numPlayers + x) = payoffMatrix.at(m).at(i).at(j)->getNodeValue(x);
+			}
+	
+	return GameFeatures<T>(numStrats, payoffs);
+}
+
 // compute impartiality
 template <typename T>
 void simGame<T>::computeImpartiality()
@@ -1479,6 +1170,50 @@ void simGame<T>::computeImpartiality()
 	impartial = true;
 }
 
+/*
+	The choices communication() starts from, and what each player switches to when they
+	know the others' choices: their first best response to everyone else's original
+	choice. That's read off the cached best-response flags, so it's one pass over each
+	player's strategies. Returns false if the game has no pure choices to start from.
+*/
+template <typename T>
+bool simGame<T>::computeInformedChoices(vector<int> &original, vector<int> &informed)
+{
+	computePureEquilibria(); // calls computeBestResponses()
+	determineType();
+	isMixed();
+	computeChoices();
+	
+	original = vector<int>(numPlayers);
+	informed = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+	{
+		original.at(x) = players.at(x)->getChoice();
+		if (original.at(x) < 0 || original.at(x) >= players.at(x)->getNumStrats())
+		{
+			cout << "ERROR: P_" << x + 1 << " doesn't have a pure choice to communicate\n";
+			return false;
+		}
+	}
+	
+	vector<int> profile = original;
+	for (int x = 0; x < numPlayers; x++)
+	{
+		informed.at(x) = original.at(x);
+		for (int s = 0; s < players.at(x)->getNumStrats(); s++)
+		{
+			profile.at(x) = s;
+			if (payoffMatrix.at(hash(profile)).at(profile.at(0)).at(profile.at(1))->getNodeBestResponse(x))
+			{
+				informed.at(x) = s;
+				break;
+			}
+		}
+		profile.at(x) = original.at(x);
+	}
+	return true;
+}
+
 // compute k-strategies
 template <typename T>
 void simGame<T>::computeKStrategies()
@@ -1487,6 +1222,14 @@ void simGame<T>::computeKStrategies()
 	int num = -1;
 	vector<int> others;
 	
+	// rationalities can change without changing the game, so kChoices are always reassigned
+	if (kStrategiesVersion == version)
+	{
+		for (int x = 0; x < numPlayers; x++)
+			players.at(x)->setKChoice(kStrategies.at(players.at(x)->getRationality()).at(x));
+		return;
+	}
+	
 	for (int r = 0; r < 4; r++)
 		for (int x = 0; x < numPlayers; x++)
 		{
@@ -1526,30 +1269,61 @@ void simGame<T>::computeKStrategies()
 					}
 				}
 				else // x >= 2
-				{					
-					for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-						for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-						{
-							for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-							{
-								if (payoffMatrix.at(m).at(others.at(0)).at(others.at(1))->getNodeBestResponse(1))
-									maxStrat = unhash(m).at(x);
-							}
-						}
-					
+				{
+					for (int s = 0; s < players.at(x)->getNumStrats(); s++)
+					{
+						others.at(x) = s;
+						if (payoffMatrix.at(hash(others)).at(others.at(0)).at(others.at(1))->getNodeBestResponse(x))
+							maxStrat = s;
+					}
 				}
 				kStrategies.at(r).at(x) = maxStrat;
 			}
 			if (r == players.at(x)->getRationality())
 				players.at(x)->setKChoice(kStrategies.at(r).at(x));
 		}
+	kStrategiesVersion = version;
 	
 	return;
 }
 
-// compute mixed equilibria
+/*
+	Who can learn whose choice if the players pass on what they know: P_x reaches P_y
+	through any chain of players who each know the next one's choice. That's the
+	transitive closure of the knowledge relation, by repeated Boolean squaring.
+*/
 template <typename T>
-void simGame<T>::computeMixedEquilibria()
+BitMatrix simGame<T>::computeKnowledgeClosure() const
+{
+	return choiceKnowledgeRelation().closure();
+}
+
+/*
+	Rounds of passing on choices before everyone knows every choice: after k rounds P_x
+	knows what's reachable in k steps of the knowledge relation. Returns 0 if it's
+	already mutual knowledge and -1 if it never becomes mutual knowledge.
+*/
+template <typename T>
+int simGame<T>::computeKnowledgeRounds() const
+{
+	BitMatrix step = choiceKnowledgeRelation();
+	BitMatrix known = step;
+	int rounds = 0;
+	
+	while (!known.isFull())
+	{
+		BitMatrix next = known.multiply(step);
+		if (next == known)
+			return -1;
+		known = next;
+		rounds++;
+	}
+	return rounds;
+}
+
+// compute mixed equilibria; exact solves the zero-sum and security LPs in fractions
+template <typename T>
+void simGame<T>::computeMixedEquilibria(bool exact)
 {
 	computePureEquilibria();
 	cout << endl;
@@ -1584,6 +1358,9 @@ void simGame<T>::computeMixedEquilibria()
 			}
 		}
 	}
+	
+	determineType();
+	printZeroSumSolution(exact);
 }
 
 // compute mixed strategies
@@ -1647,10 +1424,25 @@ void simGame<T>::computePureEquilibria()
 	LinkedList<T>* curList;
 	vector<int> strategyProfile = vector<int>(numPlayers);
 	
-	clearPureEquilibria();
-	clearParetoPureEquilibria();
 	computeBestResponses();
+	if (equilibriaVersion == version)
+	{
+		// single-payoff edits patch pureEquilibria, but Pareto optimality depends on every outcome
+		if (paretoVersion != version)
+		{
+			clearParetoPureEquilibria();
+			for (int e = 0; (unsigned)e < pureEquilibria.size(); e++)
+			{
+				if (PO(pureEquilibria.at(e)))
+					pushParetoEquilibrium(pureEquilibria.at(e));
+			}
+			paretoVersion = version;
+		}
+		return;
+	}
 	
+	clearPureEquilibria();
+	clearParetoPureEquilibria();
 	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
 		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
 		{
@@ -1669,7 +1461,7 @@ void simGame<T>::computePureEquilibria()
 				}
 				if (isEquilibrium) // at the end of payoffMatrix.at(m).at(i).at(j)
 				{					
-					strategyProfile = unhash(m);
+					unhash(m, strategyProfile);
 					strategyProfile.at(0) = i; // indices of the equilibrium going into the vector
 					strategyProfile.at(1) = j;
 					pushEquilibrium(strategyProfile);
@@ -1678,66 +1470,169 @@ void simGame<T>::computePureEquilibria()
 				}
 			}
 		}
+	equilibriaVersion = version;
+	paretoVersion = version;
 }
 
-// check if all strats in equilibrium are equal
+/*
+	P_x's maxmin (security) strategy: the mixed strategy maximizing P_x's worst-case 
+	expected payoff over all of the other players' strategy profiles. Works for 
+	general-sum games with any number of players. N is double or Rational.
+*/
 template <typename T>
-bool simGame<T>::coordination()
+template <typename N>
+bool simGame<T>::computeSecurityStrategy(int x, vector<N> &strategy, N &value, N eps)
 {
-	for (int n = 0; n < getSizePureEquilibria(); n++)
+	vector<N> others; // worst-case (minmax) mix over the other players' profiles
+	return solveMatrixGame(payoffSlice<N>(x), strategy, others, value, eps);
+}
+
+/*
+	value of the game for P_1 and both players' optimal mixed strategies in 
+	strategies.at(0) and strategies.at(1), using P_1's payoffs as the zero-sum matrix
+*/
+template <typename T>
+template <typename N>
+bool simGame<T>::computeZeroSumSolution(vector<vector<N> > &strategies, N &value, N eps)
+{
+	if (numPlayers != 2)
 	{
-		for (int x = 1; x < numPlayers; x++)
-		{
-			if (getPureEquilibrium(n).at(0) != getPureEquilibrium(n).at(x))
-				return false;
-		}
+		cout << "ERROR: zero-sum solutions require exactly 2 players\n";
+		return false;
 	}
-	return true;
+	strategies = vector<vector<N> >(2);
+	return solveMatrixGame(payoffSlice<N>(0), strategies.at(0), strategies.at(1), value, eps);
 }
 
-// determine a game's type
+/*
+	64-bit FNV-1a over the number of players, the numbers of strategies and every 
+	payoff in outcome order, so equal games hash equally across runs. Payoffs are 
+	hashed exactly (see hashPayoff()), so games that differ by a fraction don't 
+	collide. Memoized until the game changes.
+*/
+template <typename T>
+unsigned long long simGame<T>::contentHash()
+{
+	if (contentHashVersion == version)
+		return contentHashValue;
+	
+	contentHashValue = 14695981039346656037ULL;
+	long long count = numPlayers;
+	hashBytes(contentHashValue, &count, sizeof(count));
+	for (int x = 0; x < numPlayers; x++)
+	{
+		count = players.at(x)->getNumStrats();
+		hashBytes(contentHashValue, &count, sizeof(count));
+	}
+	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
+			for (int i = 0; i < players.at(0)->getNumStrats(); i++)
+				for (int x = 0; x < numPlayers; x++)
+					hashPayoff(contentHashValue, payoffMatrix.at(m).at(i).at(j)->getNodeValue(x), typename is_arithmetic<T>::type());
+	
+	contentHashVersion = version;
+	return contentHashValue;
+}
+
+// determine a game's type from its feature vector
 template <typename T>
 void simGame<T>::determineType()
 {
-	if (checkNullCondition())
-		null = true;
-	else
-		null = false;
-		
-	zs = checkZSConditions();
+	if (typeVersion == version)
+		return;
 	
-	if (checkIHConditions())
-		ih = true;
-	else
-		ih = false;
+	GameFeatures<T> features = computeFeatures();
 	
+	null = features.isNull();
+	zs = features.isZS();
+	ih = features.isIH();
 	if (numPlayers < 3)
+		pd = features.isPD();
+	pc = features.isPC();
+	bos = features.isBOS();
+	chicken = features.isChicken();
+	sh = features.isSH();
+	typeVersion = version;
+}
+
+/*
+	The outcome and whether it's Pareto-optimal for every set of players who know the
+	others' choices, without printing: results.at(mask) is the pattern where P_x knows
+	if bit x of mask is set, so results.at(0) is the original outcome and the last one
+	is everyone knowing. The best responses are found once, and the Pareto check is
+	only run once per distinct outcome, so most patterns cost a profile copy.
+*/
+template <typename T>
+bool simGame<T>::evaluateCommunication(vector<CommunicationOutcome> &results)
+{
+	vector<int> original, informed;
+	map<int, bool> paretoCache;
+	
+	if (numPlayers > 20)
 	{
-		if (checkPDConditions())
-			pd = true;
-		else
-			pd = false;
+		cout << "ERROR: too many players to evaluate every communication pattern\n";
+		return false;
+	}
+	if (!computeInformedChoices(original, informed))
+		return false;
+	
+	results = vector<CommunicationOutcome>(1 << numPlayers);
+	vector<bool> knows = vector<bool>(numPlayers);
+	for (int mask = 0; mask < (1 << numPlayers); mask++)
+	{
+		for (int x = 0; x < numPlayers; x++)
+			knows.at(x) = (mask >> x) & 1;
+		evaluatePattern(knows, original, informed, paretoCache, results.at(mask));
 	}
+	return true;
+}
 
-	if (getSizePureEquilibria() > 1 && getSizeParetoPureEquilibria() > 1 && allEqualEquilibria() && !null)
-		pc = true;
-	else
-		pc = false;
+// same, for the given sets of players who know the others' choices
+template <typename T>
+bool simGame<T>::evaluateCommunication(const vector<vector<int> > &patterns, vector<CommunicationOutcome> &results)
+{
+	vector<int> original, informed;
+	map<int, bool> paretoCache;
 	
-	if (checkBOSConditions())
-		bos = true;
-	else
-		bos = false;
+	for (int n = 0; (unsigned)n < patterns.size(); n++)
+	{
+		for (int k = 0; (unsigned)k < patterns.at(n).size(); k++)
+		{
+			if (patterns.at(n).at(k) < 0 || patterns.at(n).at(k) >= numPlayers)
+			{
+				cout << "ERROR: there's no P_" << patterns.at(n).at(k) + 1 << endl;
+				return false;
+			}
+		}
+	}
+	if (!computeInformedChoices(original, informed))
+		return false;
 	
-	if (checkChickenConditions())
-		chicken = true;
-	else
-		chicken = false;
+	results = vector<CommunicationOutcome>(patterns.size());
+	vector<bool> knows = vector<bool>(numPlayers);
+	for (int n = 0; (unsigned)n < patterns.size(); n++)
+	{
+		knows.assign(numPlayers, false);
+		for (int k = 0; (unsigned)k < patterns.at(n).size(); k++)
+			knows.at(patterns.at(n).at(k)) = true;
+		evaluatePattern(knows, original, informed, paretoCache, results.at(n));
+	}
+	return true;
+}
+
+// players who know switch to their informed choice, paretoCache is by outcome index
+template <typename T>
+void simGame<T>::evaluatePattern(const vector<bool> &knows, const vector<int> &original, const vector<int> &informed, map<int, bool> &paretoCache, CommunicationOutcome &result)
+{
+	result.outcome.resize(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+		result.outcome.at(x) = knows.at(x) ? informed.at(x) : original.at(x);
 	
-	if (checkSHConditions())
-		sh = true;
-	else
-		sh = false;
+	int index = (hash(result.outcome) * players.at(0)->getNumStrats() + result.outcome.at(0)) * players.at(1)->getNumStrats() + result.outcome.at(1);
+	map<int, bool>::iterator it = paretoCache.find(index);
+	if (it == paretoCache.end())
+		it = paretoCache.insert(make_pair(index, PO(result.outcome))).first;
+	result.paretoOptimal = it->second;
 }
 
 // edit a single player's info
@@ -1809,7 +1704,7 @@ int simGame<T>::entryBestResponseLengths(int m, int i, int j) // TEST
 
 // get entry length
 template <typename T>
-int simGame<T>::entryLength(vector<vector<vector<bool> > > extraSpaces, int m, int i, int j) // TEST
+int simGame<T>::entryLength(const vector<vector<vector<bool> > > &extraSpaces, int m, int i, int j) // TEST
 {
 	// cout << "\nENTRYLENGTH\n";
 	// returns length of the specific ij-entry in matrix m
@@ -1880,19 +1775,27 @@ vector<int> simGame<T>::enterStratProfile()
 	return stratProfile;
 }
 
-// checks if a and b are equal
+/*
+	every payoff in the order contentHash() hashes them, written exactly: doubles with 
+	the 17 digits that read back as the same value, Rationals as their whole fraction
+*/
 template <typename T>
-bool simGame<T>::equalEquilibria(int a, int b)
+vector<string> simGame<T>::exactPayoffs()
 {
-	LinkedList<T>* aList = payoffMatrix.at(hash(getPureEquilibrium(a))).at(getPureEquilibrium(a).at(0)).at(getPureEquilibrium(a).at(1));
-	LinkedList<T>* bList = payoffMatrix.at(hash(getPureEquilibrium(b))).at(getPureEquilibrium(b).at(0)).at(getPureEquilibrium(b).at(1));
+	vector<string> payoffs;
+	ostringstream out;
+	out << setprecision(17);
 	
-	for (int x = 0; x < numPlayers; x++)
-	{
-		if (aList->getNodeValue(x) != bList->getNodeValue(x))
-			return false;
-	}
-	return true;
+	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
+			for (int i = 0; i < players.at(0)->getNumStrats(); i++)
+				for (int x = 0; x < numPlayers; x++)
+				{
+					out.str("");
+					out << payoffMatrix.at(m).at(i).at(j)->getNodeValue(x);
+					payoffs.push_back(out.str());
+				}
+	return payoffs;
 }
 
 /* 
@@ -1957,7 +1860,7 @@ vector<vector<vector<bool> > > simGame<T>::extraSpacesInColumns()
 
 // converts a sequence of strategies into the index in a stack of payoff arrays that correspond to that sequence
 template <typename T>
-int simGame<T>::hash(vector<int> profile)
+int simGame<T>::hash(const vector<int> &profile)
 {
 	computeImpartiality();
 	
@@ -1994,6 +1897,35 @@ int simGame<T>::hash(vector<int> profile)
 	return num;
 }
 
+// folds size bytes into an FNV-1a hash
+template <typename T>
+void simGame<T>::hashBytes(unsigned long long &h, const void* data, int size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	for (int b = 0; b < size; b++)
+	{
+		h ^= bytes[b];
+		h *= 1099511628211ULL;
+	}
+}
+
+// ints and doubles by their bytes, with -0.0 as 0.0 so equal payoffs hash equally
+template <typename T>
+void simGame<T>::hashPayoff(unsigned long long &h, const T &payoff, true_type)
+{
+	T val = payoff + T(0);
+	hashBytes(h, &val, sizeof(val));
+}
+
+// anything else, like Rational, by the exact text it prints
+template <typename T>
+void simGame<T>::hashPayoff(unsigned long long &h, const T &payoff, false_type)
+{
+	ostringstream out;
+	out << payoff << ' ';
+	hashBytes(h, out.str().data(), out.str().size());
+}
+
 // checks if the game is mixed
 template <typename T>
 void simGame<T>::isMixed()
@@ -2036,7 +1968,7 @@ bool simGame<T>::isInferior()
 
 // checks if profile is a pure equilibrium
 template <typename T>
-bool simGame<T>::isPureEquilibrium(vector<int> profile)
+bool simGame<T>::isPureEquilibrium(const vector<int> &profile)
 {
 	for (int n = 0; n < getSizePureEquilibria(); n++)
 	{
@@ -2100,7 +2032,7 @@ bool simGame<T>::isStrictlyDominant(int x, int s)
 			for (int i = 0; i < players.at(0)->getNumStrats(); i++) // row in s
 				for (int j = 0; j < players.at(1)->getNumStrats(); j++) // column in s
 				{
-					profile = unhash(m);
+					unhash(m, profile);
 					if (profile.at(x) != s)
 					{
 						curList = payoffMatrix.at(hash(profile)).at(i).at(s);
@@ -2183,19 +2115,19 @@ bool simGame<T>::isStrictlyDominated(int x, int s)
 		int curM = 0, m = 0, product = 1;
 		vector<int> curProfile = vector<int>(numPlayers);
 		vector<int> sProfile = vector<int>(numPlayers);
-		sProfile = unhash(0);
+		unhash(0, sProfile);
 		sProfile.at(x) = s;
 		m = hash(sProfile);
 		// cout << "start: " << m << endl;
 		while ((unsigned)m < payoffMatrix.size() - players.at(x)->getNumStrats() + s + 1) // selects s in each section
 		{
 			// cout << "m: " << m << endl;
-			sProfile = unhash(m);
+			unhash(m, sProfile);
 			sProfile.at(x) = s;
 			while ((unsigned)curM < payoffMatrix.size()) // checks other sections for dominant strategies
 			{
 				// cout << "\tcurM: " << curM << endl;
-				curProfile = unhash(curM);
+				unhash(curM, curProfile);
 				if (curProfile != sProfile)
 				{
 					for (int i = 0; i < players.at(0)->getNumStrats(); i++) // row in s
@@ -2304,7 +2236,7 @@ bool simGame<T>::isWeaklyDominant(int x, int s)
 			for (int i = 0; i < players.at(0)->getNumStrats(); i++) // row in s
 				for (int j = 0; j < players.at(1)->getNumStrats(); j++) // column in s
 				{
-					sProfile = unhash(m);
+					unhash(m, sProfile);
 					sProfile.at(x) = s;
 					
 					sList = payoffMatrix.at(hash(sProfile)).at(i).at(s);
@@ -2318,7 +2250,7 @@ bool simGame<T>::isWeaklyDominant(int x, int s)
 						{
 							for (int j2 = 0; j2 < players.at(1)->getNumStrats(); j2++) // 2nd column counter
 							{
-								profile = unhash(m);
+								unhash(m, profile);
 							
 								/* Comparing P_x's strategies with each other, keeping P_x's strategy
 								the same, so we vary over P_x's strategies */
@@ -2435,7 +2367,7 @@ bool simGame<T>::isWeaklyDominated(int x, int s)
 			for (int i = 0; i < players.at(0)->getNumStrats(); i++) // row in s
 				for (int j = 0; j < players.at(1)->getNumStrats(); j++) // column in s
 				{
-					sProfile = unhash(m);
+					unhash(m, sProfile);
 					sProfile.at(x) = s;
 					
 					em = 0;
@@ -2445,7 +2377,7 @@ bool simGame<T>::isWeaklyDominated(int x, int s)
 						{
 							for (int j2 = 0; j2 < players.at(1)->getNumStrats(); j2++) // 2nd column counter
 							{
-								profile = unhash(m);
+								unhash(m, profile);
 							
 								/* Comparing P_x's strategies with each other, keeping P_x's strategy
 								the same, so we vary over P_x's strategies */
@@ -2491,6 +2423,53 @@ bool simGame<T>::isWeaklyDominated(int x, int s)
 	return true;
 }
 
+/*
+	Takes the equilibria, type and k-strategies from cache if this game was analyzed 
+	before. Best responses aren't stored; they're recomputed when next needed.
+*/
+template <typename T>
+bool simGame<T>::loadAnalysis(const AnalysisCache &cache)
+{
+	CachedAnalysis result;
+	vector<int> numStrats = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+		numStrats.at(x) = players.at(x)->getNumStrats();
+	
+	if (!cache.find(contentHash(), numStrats, exactPayoffs(), result))
+		return false;
+	
+	pureEquilibria = result.pureEquilibria;
+	paretoPureEquilibria = result.paretoPureEquilibria;
+	equilibriaVersion = version;
+	paretoVersion = version;
+	
+	null = result.types.at(0);
+	zs = result.types.at(1);
+	ih = result.types.at(2);
+	pd = result.types.at(3);
+	pc = result.types.at(4);
+	bos = result.types.at(5);
+	chicken = result.types.at(6);
+	sh = result.types.at(7);
+	typeVersion = version;
+	
+	kStrategies = result.kStrategies;
+	kStrategiesVersion = version;
+	return true;
+}
+
+// order of profiles in pureEquilibria: by matrix, then row, then column
+template <typename T>
+bool simGame<T>::lessThanProfile(const vector<int> &a, const vector<int> &b)
+{
+	int mA = hash(a), mB = hash(b);
+	if (mA != mB)
+		return mA < mB;
+	if (a.at(0) != b.at(0))
+		return a.at(0) < b.at(0);
+	return a.at(1) < b.at(1);
+}
+
 // returns vector w/ maximum number of characters added by brackets in BR's in each column
 template <typename T>
 vector<vector<int> > simGame<T>::maxBestResponseLengths()
@@ -2591,7 +2570,7 @@ vector<vector<int> > simGame<T>::maxEntryLengths(vector<vector<vector<bool> > >
 
 // returns the maximum payoff in a specific row, column, or section of matrices. In the third case, it is comparing the values for the same ij-entry of each matrix in the section
 template <typename T>
-int simGame<T>::maxPayoffInRowColOrMatrices(int x, vector<int> choices)
+int simGame<T>::maxPayoffInRowColOrMatrices(int x, const vector<int> &choices)
 {	
 	int maxVal = -std::numeric_limits<int>::max();
 	LinkedList<T>* curList;
@@ -2723,7 +2702,8 @@ int simGame<T>::maxStrat(int x)
 {
 	// cout << "MAXSTRAT\n";
 	
-	int maxStrat = 0, maxVal = -std::numeric_limits<int>::max();
+	int maxStrat = 0;
+	T maxVal = -std::numeric_limits<int>::max();
 	LinkedList<T>* curList;
 	
 	if (x == 0)
@@ -2774,9 +2754,68 @@ int simGame<T>::maxStrat(int x)
 	return maxStrat;
 }
 
+// everyone knows every choice
+template <typename T>
+bool simGame<T>::mutualKnowledge() const
+{
+	return choiceKnowledgeRelation().isFull();
+}
+
+// index of the other players' strategies in profile, with P_x's strategy left out
+template <typename T>
+int simGame<T>::opponentsIndex(int x, const vector<int> &profile)
+{
+	int index = 0, product = 1;
+	for (int y = 0; y < numPlayers; y++)
+	{
+		if (y != x)
+		{
+			index += product * profile.at(y);
+			product *= players.at(y)->getNumStrats();
+		}
+	}
+	return index;
+}
+
+// P_x's payoffs with a row for each of P_x's strategies and a column for each of the other players' profiles
+template <typename T>
+template <typename N>
+vector<vector<N> > simGame<T>::payoffSlice(int x)
+{
+	int numColumns = 1;
+	vector<int> profile = vector<int>(numPlayers);
+	for (int y = 0; y < numPlayers; y++)
+	{
+		if (y != x)
+			numColumns *= players.at(y)->getNumStrats();
+	}
+	vector<vector<N> > slice = vector<vector<N> >(players.at(x)->getNumStrats(), vector<N>(numColumns));
+	
+	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+	{
+		unhash(m, profile);
+		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
+			for (int j = 0; j < players.at(1)->getNumStrats(); j++)
+			{
+				profile.at(0) = i;
+				profile.at(1) = j;
+				slice.at(profile.at(x)).at(opponentsIndex(x, profile)) = N(payoffMatrix.at(m).at(i).at(j)->getNodeValue(x));
+			}
+	}
+	return slice;
+}
+
+// P_x's payoffs changed: only P_x's best responses and the results built from all payoffs go stale
+template <typename T>
+void simGame<T>::payoffsChanged(int x)
+{
+	version++;
+	payoffVersions.at(x) = version;
+}
+
 // checks if strategy is Pareto-optimal
 template <typename T>
-bool simGame<T>::PO(vector<int> stratProfile)
+bool simGame<T>::PO(const vector<int> &stratProfile)
 {
 	LinkedList<T>* curList;
 	LinkedList<T>* profile = payoffMatrix.at(hash(stratProfile)).at(stratProfile.at(0)).at(stratProfile.at(1));
@@ -2843,7 +2882,7 @@ bool simGame<T>::PO(vector<int> stratProfile)
 	vector<int> comparing = vector<int>(numPlayers);
 	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
 	{
-		comparing = unhash(m);
+		unhash(m, comparing);
 		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
 		{
 			comparing.at(0) = i;
@@ -2862,7 +2901,6 @@ bool simGame<T>::PO(vector<int> stratProfile)
 					{
 						// cout << "\t\t\tx: " << x << endl;
 						curList = payoffMatrix.at(m).at(i).at(j);
-						profile = payoffMatrix.at(hash(stratProfile)).at(stratProfile.at(0)).at(stratProfile.at(1));
 						/*
 						count = 0;
 						while (count < x)
@@ -2881,9 +2919,7 @@ bool simGame<T>::PO(vector<int> stratProfile)
 							
 							foundOneBetter = true;
 							betterOffPlayers.push_back(x);
-							betterOutcomes.push_back(unhash(m)); // first two are -1
-								betterOutcomes.at(betterOutcomes.size() - 1).at(0) = i;
-								betterOutcomes.at(betterOutcomes.size() - 1).at(1) = j;
+							betterOutcomes.push_back(comparing);
 							worseOff.push_back(false); // for checking later
 						}
 						else if (profile->getNodeValue(x) > curList->getNodeValue(x)) // P_x is worse off at curNode
@@ -2892,9 +2928,7 @@ bool simGame<T>::PO(vector<int> stratProfile)
 							
 							foundOneWorse = true;
 							worseOffPlayers.push_back(x);
-							worseOutcomes.push_back(unhash(m)); // first two are -1
-								worseOutcomes.at(worseOutcomes.size() - 1).at(0) = i;
-								worseOutcomes.at(worseOutcomes.size() - 1).at(1) = j;
+							worseOutcomes.push_back(comparing);
 							betterOff.push_back(false); // for checking later
 						}
 						x++;
@@ -2924,7 +2958,6 @@ bool simGame<T>::PO(vector<int> stratProfile)
 				if (betterOffPlayers.at(n) != x) // possibly incorrect, but doesn't matter if it checks the same player bc that player is already better off
 				{
 					curList = payoffMatrix.at(hash(betterOutcomes.at(n))).at(betterOutcomes.at(n).at(0)).at(betterOutcomes.at(n).at(1));
-					profile = payoffMatrix.at(hash(stratProfile)).at(stratProfile.at(0)).at(stratProfile.at(1));
 					/*
 					count = 0;
 					while (count < x)
@@ -2981,7 +3014,7 @@ void simGame<T>::printBestResponses()
 		cout << endl;
 		if (numPlayers > 2)
 		{			
-			stratProfile = unhash(m);
+			unhash(m, stratProfile);
 		
 			if (numPlayers == 3)
 				cout << "(c_3) = (";
@@ -3107,7 +3140,7 @@ void simGame<T>::printBothSeparately()
 		cout << endl;
 		if (numPlayers > 2)
 		{			
-			stratProfile = unhash(m);
+			unhash(m, stratProfile);
 		
 			if (numPlayers == 3)
 				cout << "(c_3) = (";
@@ -3537,7 +3570,7 @@ void simGame<T>::printPayoffMatrix()
 		cout << endl;
 		if (numPlayers > 2)
 		{			
-			profile = unhash(m);
+			unhash(m, profile);
 			if (numPlayers == 3)
 				cout << "(c_3) = (";
 			else if (numPlayers == 4)
@@ -3691,6 +3724,19 @@ void simGame<T>::printPayoffMatrix()
 		cout << "NULL: inconsequential outcomes; enter different payoffs\n";
 	else
 		cout << "Undetermined\n";
+	
+	// the canonical search is exhaustive, so it only runs for the 2x2 games it's printed for
+	if (numPlayers == 2 && players.at(0)->getNumStrats() == 2 && players.at(1)->getNumStrats() == 2)
+	{
+		CanonicalForm form = computeCanonicalForm();
+		if (form.isStrictOrdinal2x2())
+		{
+			cout << "Strict ordinal 2x2 game: #" << form.getStrict2x2Index() + 1 << " of 144";
+			if (form.strict2x2Name() != "")
+				cout << " (symmetric " << form.strict2x2Name() << ")";
+			cout << endl;
+		}
+	}
 }
 
 // print payoff matrix without info
@@ -3712,7 +3758,7 @@ void simGame<T>::printPayoffMatrixSansInfo()
 		cout << endl;
 		if (numPlayers > 2)
 		{			
-			profile = unhash(m);
+			unhash(m, profile);
 			if (numPlayers == 3)
 				cout << "(c_3) = (";
 			else if (numPlayers == 4)
@@ -3790,7 +3836,7 @@ void simGame<T>::printPayoffs()
 		cout << endl;
 		if (numPlayers > 2)
 		{			
-			stratProfile = unhash(m);
+			unhash(m, stratProfile);
 			if (numPlayers == 3)
 				cout << "(c_3) = (";
 			else if (numPlayers == 4)
@@ -3935,8 +3981,6 @@ void simGame<T>::printPlayers() const
 template <typename T>
 void simGame<T>::printPureEquilibria()
 {	
-	clearPureEquilibria();
-	clearParetoPureEquilibria();
 	computePureEquilibria();
 	
 	if (getSizePureEquilibria() == 0)
@@ -3982,21 +4026,92 @@ void simGame<T>::printPureEquilibria()
 	}
 }
 
+// print the value and optimal strategies of a zero-sum game and every player's security strategy, in fractions if exact
+template <typename T>
+void simGame<T>::printZeroSumSolution(bool exact)
+{
+	if (numPlayers == 2)
+	{
+		cout << "\nZero-sum solution (P_1's payoffs):\n";
+		cout << "--------------------------\n";
+		if (!zs)
+			cout << "(the game is not zero-sum, so this is the solution of P_1's payoff matrix)\n";
+		if (exact)
+		{
+			vector<vector<Rational> > strategies;
+			Rational value;
+			if (computeZeroSumSolution(strategies, value, Rational(0)))
+			{
+				cout << "v = " << value << endl;
+				for (int x = 0; x < 2; x++)
+					for (int s = 0; (unsigned)s < strategies.at(x).size(); s++)
+						cout << "P(P_" << x + 1 << " chooses s_" << s + 1 << ") = " << strategies.at(x).at(s) << endl;
+			}
+		}
+		else
+		{
+			vector<vector<double> > strategies;
+			double value;
+			if (computeZeroSumSolution(strategies, value, 1e-9))
+			{
+				cout << "v = " << value << endl;
+				for (int x = 0; x < 2; x++)
+					for (int s = 0; (unsigned)s < strategies.at(x).size(); s++)
+						cout << "P(P_" << x + 1 << " chooses s_" << s + 1 << ") = " << strategies.at(x).at(s) << endl;
+			}
+		}
+	}
+	
+	cout << "\nSecurity strategies:\n";
+	cout << "--------------------------\n";
+	for (int x = 0; x < numPlayers; x++)
+	{
+		if (exact)
+		{
+			vector<Rational> strategy;
+			Rational value;
+			if (!computeSecurityStrategy(x, strategy, value, Rational(0)))
+				continue;
+			cout << "P_" << x + 1 << ": (";
+			for (int s = 0; (unsigned)s < strategy.size(); s++)
+			{
+				cout << strategy.at(s);
+				if ((unsigned)s < strategy.size() - 1)
+					cout << ", ";
+			}
+			cout << "), guaranteed " << value << endl;
+		}
+		else
+		{
+			vector<double> strategy;
+			double value;
+			if (!computeSecurityStrategy(x, strategy, value, 1e-9))
+				continue;
+			cout << "P_" << x + 1 << ": (";
+			for (int s = 0; (unsigned)s < strategy.size(); s++)
+			{
+				cout << strategy.at(s);
+				if ((unsigned)s < strategy.size() - 1)
+					cout << ", ";
+			}
+			cout << "), guaranteed " << value << endl;
+		}
+	}
+}
+
 // produce a random game with payoffs between 0 and 100
 template <typename T>
 void simGame<T>::randGame()
 {
 	bool addMoreOutcomesPast2 = false; // kMatrix
-	int nP = -1, nS = -1, oldNumPlayers = -1, oldNumStrats[numPlayers], oldSize = -1;
-	LinkedList<T>* curList;
+	int nP = -1, nS = -1, oldNumPlayers = -1;
+	vector<int> oldNumStrats = vector<int>(numPlayers);
 	srand(time(NULL));
 	
 	oldNumPlayers = numPlayers;
 	
 	for (int x = 0; x < numPlayers; x++)
-		oldNumStrats[x] = players.at(x)->getNumStrats();
-	
-	oldSize = payoffMatrix.size();
+		oldNumStrats.at(x) = players.at(x)->getNumStrats();
 	
 	cout << "Enter the number of players from 2 to 4:  ";
 	cin >> nP;
@@ -4036,57 +4151,29 @@ void simGame<T>::randGame()
 	}
 	cout << endl;
 	
-	// resizing payoffMatrix and kMatrix
+	// moving the payoffs into the new shape, then entering random values
+	vector<int> newNumStrats = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+		newNumStrats.at(x) = players.at(x)->getNumStrats();
+	reshape(oldNumStrats, newNumStrats);
+	
 	if (oldNumPlayers != numPlayers)
 	{		
 		for (int r = 0; r < 4; r++)
 			kStrategies.at(r).resize(numPlayers);
 		
-		// new matrices need to be inserted in the correct positions, not added at the end
 		int size = 1;
-		if (numPlayers > 2)
-		{
-			for (int x = 2; x < numPlayers; x++)
-				size *= players.at(x)->getNumStrats();
-		}
-		payoffMatrix.resize(size);
-		
-		size = 1;
 		if (numPlayers > 2)
 			size = pow(4, numPlayers - 2);
 		
 		kMatrix.resize(size);
 	}
 	
-	// creating/deleting entries and entering random values
 	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-	{
-		payoffMatrix.at(m).resize(players.at(0)->getNumStrats());
 		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-		{
-			payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats());
 			for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-			{						
-				// create new list if needed
-				if (!payoffMatrix.at(m).at(i).at(j))
-				{
-					LinkedList<T>* newList = new LinkedList<T>;
-					payoffMatrix.at(m).at(i).at(j) = newList;
-				}
-				curList = payoffMatrix.at(m).at(i).at(j);
-				while (curList->getSize() > numPlayers)
-					curList->deleteNode(curList->getSize() - 1); // DELETING
-				
 				for (int x = 0; x < numPlayers; x++)
-				{
-					if (m < oldSize && x < oldNumPlayers && i < oldNumStrats[0] && j < oldNumStrats[1]) // old matrix, old payoff, old outcome
-						curList->setNodeValue(x, rand() % 100);
-					else // everything else is new
-						curList->appendNode(rand() % 100, false); // ADDING
-				}
-			}
-		}
-	}
+					payoffMatrix.at(m).at(i).at(j)->setNodeValue(x, rand() % 100);
 	
 	// resizing kMatrix
 	if (addMoreOutcomesPast2)
@@ -4105,6 +4192,7 @@ void simGame<T>::randGame()
 			}
 		}
 	}
+	shapeChanged();
 	printPayoffMatrix();
 }
 
@@ -4112,24 +4200,21 @@ void simGame<T>::randGame()
 template <typename T>
 void simGame<T>::randType()
 {
-	bool changeNumStratsP1 = false, changeNumStratsP2 = false, changeNumStratsPastP2 = false;
 	bool addMoreOutcomesPast2 = false; // kMatrix
-	int nP = -1, nS = -1, oldNumPlayers = -1, oldNumStrats[numPlayers], type = -1;
-	LinkedList<T>* curList;
+	int oldNumPlayers = -1, type = -1;
+	vector<int> oldNumStrats = vector<int>(numPlayers);
 	srand(time(NULL));
 	
 	oldNumPlayers = numPlayers;
 	
 	for (int x = 0; x < numPlayers; x++)
-		oldNumStrats[x] = players.at(x)->getNumStrats();
+		oldNumStrats.at(x) = players.at(x)->getNumStrats();
 	
 	numPlayers = 2; // program is currently only capable of determining types of 2 x 2 games
 	
 	// add new players if there are more and increase the size of kStrategy vectors
 	if (oldNumPlayers != numPlayers)
 	{
-		changeNumStratsPastP2 = true;
-		
 		if (oldNumPlayers < numPlayers)
 			addMoreOutcomesPast2 = true;
 		
@@ -4140,117 +4225,20 @@ void simGame<T>::randType()
 		}
 	}
 	
-	for (int x = 0; x < numPlayers; x++)
-	{
-		players.at(x)->setNumStrats(2);
-		
-		if (!changeNumStratsPastP2 && x > 1 && oldNumStrats[x] != players.at(x)->getNumStrats())
-			changeNumStratsPastP2 = true;
-	}
-	
-	if (oldNumStrats[0] != players.at(0)->getNumStrats())
-		changeNumStratsP1 = true;
-	if (oldNumStrats[1] != players.at(1)->getNumStrats())
-		changeNumStratsP2 = true;
+	reshape(oldNumStrats, vector<int>(numPlayers, 2));
 	
-	// resizing payoffMatrix and kMatrix
 	if (oldNumPlayers != numPlayers)
 	{		
 		for (int r = 0; r < 4; r++)
 			kStrategies.at(r).resize(numPlayers);
 		
-		// new matrices need to be inserted in the correct positions, not added at the end
 		int size = 1;
-		if (numPlayers > 2)
-		{
-			for (int x = 2; x < numPlayers; x++)
-				size *= players.at(x)->getNumStrats();
-		}
-		payoffMatrix.resize(size);
-		
-		size = 1;
 		if (numPlayers > 2)
 			size = pow(4, numPlayers - 2);
 		
 		kMatrix.resize(size);
 	}
 	
-	// resizing 2D matrices in payoffMatrix
-	if (changeNumStratsP1)
-	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++) // goes through the added matrices
-		{
-			// set number of rows; automatically deletes extras
-			payoffMatrix.at(m).resize(players.at(0)->getNumStrats());
-			
-			int iStart = -1, iEnd = -1;
-			if (oldNumStrats[0] < players.at(0)->getNumStrats()) // old1 < i < nS1
-			{
-				iStart = oldNumStrats[0];
-				iEnd = players.at(0)->getNumStrats();
-			}
-			
-			if (iStart == oldNumStrats[0]) // Adding entries, skip if same
-			{
-				for (int i = iStart; i < iEnd; i++) // for rows oldNumStrats,...,newNumStrats
-				{
-					// new vectors are of size 0 and must be resized
-					payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats());
-					for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-					{
-						LinkedList<T>* newList = new LinkedList<T>;
-						payoffMatrix.at(m).at(i).at(j) = newList; // head is he first node of the list in payoffMatrix.at(0).at(i).at(j)
-					}
-				}
-			}
-		}
-	}
-	
-	if (changeNumStratsP2)
-	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++) // goes through the added matrices
-		{
-			payoffMatrix.at(m).resize(players.at(0)->getNumStrats());			
-			for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-			{
-				// set number of columns in each row; automatically deletes extras
-				payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats());
-				
-				int jStart = -1, jEnd = -1;
-				if (oldNumStrats[1] < players.at(1)->getNumStrats()) // Adding: old2 < j < nS2
-				{							
-					jStart = oldNumStrats[1];
-					jEnd = players.at(1)->getNumStrats();
-				}
-				if (jStart == oldNumStrats[1]) // Adding entries, skip if same
-				{
-					for (int j = jStart; j < jEnd; j++)
-					{
-						LinkedList<T>* newList = new LinkedList<T>;
-						payoffMatrix.at(m).at(i).at(j) = newList; // head is he first node of the list in payoffMatrix.at(m).at(i).at(j)
-					}
-				}
-			}
-		}
-	}
-	
-	if (changeNumStratsPastP2)
-	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++) // goes through the added matrices
-		{
-			payoffMatrix.at(m).resize(players.at(0)->getNumStrats());
-			for(int i = 0; i < players.at(0)->getNumStrats(); i++)
-			{						
-				payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats());
-				for(int j = 0; j < players.at(1)->getNumStrats(); j++)
-				{	
-					LinkedList<T>* newList = new LinkedList<T>;
-					payoffMatrix.at(m).at(i).at(j) = newList; // head is he first node of the list in payoffMatrix.at(0).at(i).at(j)
-				}
-			}
-		}
-	}
-	
 	// resizing kMatrix
 	if (addMoreOutcomesPast2)
 	{
@@ -4349,14 +4337,19 @@ void simGame<T>::randType()
 		
 	}
 	
+	shapeChanged();
 	printPayoffMatrix();
 }
 
-// read game from file
+/*
+	read game from file. With a cache, the game's analysis is taken from it if the 
+	same game was read before, and otherwise computed now and saved to it.
+*/
 template <typename T>
-void simGame<T>::readFromFile()
+void simGame<T>::readFromFile(AnalysisCache* cache)
 {
 	bool addMoreOutcomesPast2 = false; // kMatrix
+	bool opened = false;
 	ifstream infile;
 	int nP = -1, nS = -1, r = -1;
 	int oldNumPlayers = -1, oldNumStrats[numPlayers], oldSize = -1;
@@ -4371,6 +4364,7 @@ void simGame<T>::readFromFile()
 		cout << "\nERROR: could not open file\n";
 	else
 	{
+		opened = true;
 		while (!infile.eof())
 		{
 			oldNumPlayers = numPlayers;
@@ -4460,7 +4454,7 @@ void simGame<T>::readFromFile()
 						// create new list if needed
 						if (!payoffMatrix.at(m).at(i).at(j))
 						{
-							LinkedList<T>* newList = new LinkedList<T>;
+							LinkedList<T>* newList = listPool.create(&nodePool);
 							payoffMatrix.at(m).at(i).at(j) = newList;
 						}
 						curList = payoffMatrix.at(m).at(i).at(j);
@@ -4510,6 +4504,12 @@ void simGame<T>::readFromFile()
 		infile.close();
 	}
 	
+	shapeChanged();
+	if (opened && cache && !loadAnalysis(*cache))
+	{
+		storeAnalysis(*cache);
+		cache->save();
+	}
 	printPayoffMatrix();
 }
 
@@ -4541,113 +4541,19 @@ void simGame<T>::reduce()
 template <typename T>
 void simGame<T>::removeStrategy(int x, int s)
 {
-	if (x == 0)
-	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-			payoffMatrix.at(m).erase(payoffMatrix.at(m).begin() + s);
-	}
-	else if (x == 1)
-	{
-		for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-		{
-			for(int i = 0; i < players.at(0)->getNumStrats(); i++)
-				payoffMatrix.at(m).at(i).erase(payoffMatrix.at(m).at(i).begin() + s);
-		}
-	}
-	else // x > 1
+	vector<int> oldNumStrats = vector<int>(numPlayers);
+	vector<vector<int> > sources = vector<vector<int> >(numPlayers);
+	
+	for (int y = 0; y < numPlayers; y++)
 	{
-		int numErased = 0;
-		int product = 1;
-		int m = 0;
-		vector<int> end = vector<int>(numPlayers);
-		for (int y = 0; y < numPlayers; y++)
-		{
-			if (y != x)
-				end.at(y) = players.at(y)->getNumStrats();
-			else
-				end.at(y) = s;
-		}
-		
-		vector<int> profile = vector<int>(numPlayers);
-		while (m < hash(end))
+		oldNumStrats.at(y) = players.at(y)->getNumStrats();
+		for (int t = 0; t < oldNumStrats.at(y); t++)
 		{
-			profile = unhash(m);
-			profile.at(x) = s; // at start of section
-			int num = 1;
-			if (x < numPlayers - 1)
-			{
-				for (int y = 2; y < numPlayers; y++)
-				{
-					if (y != x)
-						num *= players.at(y)->getNumStrats();
-				}
-			}
-			else if (x == numPlayers - 1 && numPlayers > 3)
-				num = players.at(x)->getNumStrats();
-			while (numErased < num)
-			{
-				payoffMatrix.erase(payoffMatrix.begin() + hash(profile));
-				numErased++;
-				
-				// last player's matrices are all lined up; others' must be found
-				if (x < numPlayers - 1)
-				{
-					cout << endl;
-					if (profile.at(2) > 0) // simply decrement first number
-						profile.at(2)--;
-					else // go through each succeeding number
-					{
-						int y = 2;
-						bool foundNonzero = false;
-						do 
-						{							
-							profile.at(y) = players.at(y)->getNumStrats() - 1;
-							// not last number and next number is nonzero
-							if (y != numPlayers - 1 && profile.at(y + 1) != 0)
-							{
-								profile.at(y + 1)--;
-								foundNonzero = true;
-							}
-							// not last number and next number is 0
-							else if (y != numPlayers - 1 && profile.at(y + 1) == 0)
-								profile.at(y) = players.at(y)->getNumStrats() - 1;
-							else if (y == numPlayers - 1) // at last number
-								profile.at(y)--;
-							y++; // move to next number
-							
-							/* stop when arrive at a number > 0 
-							or when we get to the last number */
-						} while (y < numPlayers && profile.at(y) == 0 && !foundNonzero);
-					}
-					
-					bool incremented = false;
-					int y = 2;
-					while (!incremented && y < numPlayers)
-					{
-						if (y != x)
-						{
-							if (profile.at(y) != players.at(y)->getNumStrats() - 1)
-							{
-								profile.at(y)++;
-								incremented = true;
-							}
-						}
-						y++;
-					}
-				}
-			}
-			if (x > 2 && x < numPlayers - 1 && product == 1)
-			{
-				for (int y = 2; y <= x - 1; y++)
-					product *= players.at(y)->getNumStrats();
-			}
-			m += product; // move to the next one, which is the first in the next section
+			if (y != x || t != s)
+				sources.at(y).push_back(t);
 		}
 	}
-	players.at(x)->setNumStrats(players.at(x)->getNumStrats() - 1);
-	
-	if (impartial)
-		impartial = false;
+	reshape(oldNumStrats, sources);
 }
 
 // prevents removal of a strategy
@@ -4664,41 +4570,146 @@ void simGame<T>::removeStrategyPrompt(int x)
 		int s;
 		cout << "Which of P_" << x + 1 << "'s strategies would you like to remove?  ";
 		cin >> s;
-		s--;
+		validate(s, 1, players.at(x)->getNumStrats());
 		
-		if (x == 0)
+		removeStrategy(x, s - 1);
+		printPayoffMatrix();
+	}
+}
+
+/*
+	Moves the payoff lists from the layout for oldNumStrats into the layout for the current
+	players. sources.at(x).at(s) is the old strategy that becomes P_x's strategy s, or -1 if
+	s is new, so P_x ends up with sources.at(x).size() strategies, and an old strategy listed
+	twice is copied. A player past the old ones counts as having had one strategy, and a
+	player past numPlayers is dropped along with every outcome but the ones where they
+	play s_1.
+	
+	Each new outcome takes its list from the old one it maps to, or gets a new list of 0s,
+	and every list ends up with numPlayers payoffs. The old index of a matrix is the sum of
+	each player's old stride times their old strategy, so the whole remap is one pass over
+	the outcomes, and lists nothing mapped to are freed at the end.
+*/
+template <typename T>
+void simGame<T>::reshape(const vector<int> &oldNumStrats, const vector<vector<int> > &sources)
+{
+	int oldNumPlayers = oldNumStrats.size();
+	int size = 1;
+	vector<int> oldStrides = vector<int>(numPlayers, 0); // distance between P_x's matrices in the old stack
+	vector<int> counts = vector<int>(numPlayers, 0); // strategies of P_3,...,P_n in the matrix being filled
+	vector<bool> moved; // old lists already in newMatrix, by m * n_1 * n_2 + i * n_2 + j
+	vector<vector<vector<LinkedList<T>*> > > newMatrix;
+	
+	if ((int)sources.size() != numPlayers)
+	{
+		cout << "ERROR: every player needs a list of their old strategies\n";
+		return;
+	}
+	for (int x = 0; x < numPlayers; x++)
+	{
+		int old = x < oldNumPlayers ? oldNumStrats.at(x) : 1;
+		for (int s = 0; (unsigned)s < sources.at(x).size(); s++)
 		{
-			for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-				payoffMatrix.at(m).erase(payoffMatrix.at(m).begin() + s);
+			if (sources.at(x).at(s) < -1 || sources.at(x).at(s) >= old)
+			{
+				cout << "ERROR: P_" << x + 1 << " didn't have a strategy " << sources.at(x).at(s) + 1 << endl;
+				return;
+			}
 		}
-		else if (x == 1)
+	}
+	
+	for (int x = 2, stride = 1; x < numPlayers && x < oldNumPlayers; x++)
+	{
+		oldStrides.at(x) = stride;
+		stride *= oldNumStrats.at(x);
+	}
+	int oldRows = oldNumStrats.at(0), oldCols = oldNumStrats.at(1);
+	moved = vector<bool>(payoffMatrix.size() * oldRows * oldCols, false);
+	for (int x = 0; x < numPlayers; x++)
+		players.at(x)->setNumStrats(sources.at(x).size());
+	for (int x = 2; x < numPlayers; x++)
+		size *= sources.at(x).size();
+	
+	newMatrix = vector<vector<vector<LinkedList<T>*> > >(size);
+	for (int m = 0; m < size; m++)
+	{
+		int oldM = 0; // -1 if some player's strategy is new
+		for (int x = 2; x < numPlayers && oldM != -1; x++)
 		{
-			for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
-				for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-					payoffMatrix.at(m).at(i).erase(payoffMatrix.at(m).at(i).begin() + s);
+			if (sources.at(x).at(counts.at(x)) == -1)
+				oldM = -1;
+			else
+				oldM += oldStrides.at(x) * sources.at(x).at(counts.at(x));
 		}
-		else // x >= 2
+		
+		newMatrix.at(m).resize(sources.at(0).size());
+		for (int i = 0; (unsigned)i < sources.at(0).size(); i++)
 		{
-			vector<int> profile = vector<int>(numPlayers);
-			for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+			newMatrix.at(m).at(i).resize(sources.at(1).size());
+			for (int j = 0; (unsigned)j < sources.at(1).size(); j++)
 			{
-				profile = unhash(m);
-				if (profile.at(x) == s)
-					payoffMatrix.erase(payoffMatrix.begin() + s);
+				int oldI = sources.at(0).at(i), oldJ = sources.at(1).at(j);
+				LinkedList<T>* oldList = NULL;
+				LinkedList<T>* list = NULL;
+				
+				if (oldM != -1 && oldI != -1 && oldJ != -1)
+					oldList = payoffMatrix.at(oldM).at(oldI).at(oldJ);
+				if (oldList && !moved.at((oldM * oldRows + oldI) * oldCols + oldJ))
+				{
+					list = oldList;
+					moved.at((oldM * oldRows + oldI) * oldCols + oldJ) = true;
+				}
+				else
+				{
+					// a new outcome, or a copy of an old one whose list was already taken
+					list = listPool.create(&nodePool);
+					for (int x = 0; oldList && x < oldList->getSize() && x < numPlayers; x++)
+						list->appendNode(oldList->getNodeValue(x), false);
+				}
+				while (list->getSize() > numPlayers)
+					list->deleteNode(list->getSize() - 1);
+				while (list->getSize() < numPlayers)
+					list->appendNode(0, false);
+				newMatrix.at(m).at(i).at(j) = list;
 			}
 		}
-		players.at(x)->setNumStrats(players.at(x)->getNumStrats() - 1);
-		
-		if (impartial)
-			impartial = false;
 		
-		printPayoffMatrix();
+		// next profile of P_3,...,P_n, P_3 fastest like hash()
+		for (int x = 2; x < numPlayers && ++counts.at(x) == (int)sources.at(x).size(); x++)
+			counts.at(x) = 0;
+	}
+	
+	// whatever is left belonged to a removed strategy or player
+	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+		for (int i = 0; (unsigned)i < payoffMatrix.at(m).size(); i++)
+			for (int j = 0; (unsigned)j < payoffMatrix.at(m).at(i).size(); j++)
+				if (payoffMatrix.at(m).at(i).at(j) && !moved.at((m * oldRows + i) * oldCols + j))
+					listPool.destroy(payoffMatrix.at(m).at(i).at(j));
+	payoffMatrix.swap(newMatrix);
+	
+	computeNumOutcomes();
+	computeImpartiality();
+	shapeChanged();
+}
+
+// keeps each player's first strategies, up to newNumStrats.at(x) of them, and adds new ones after
+template <typename T>
+void simGame<T>::reshape(const vector<int> &oldNumStrats, const vector<int> &newNumStrats)
+{
+	vector<vector<int> > sources = vector<vector<int> >(numPlayers);
+	
+	for (int x = 0; x < numPlayers; x++)
+	{
+		int old = (unsigned)x < oldNumStrats.size() ? oldNumStrats.at(x) : 1;
+		for (int s = 0; s < newNumStrats.at(x); s++)
+			sources.at(x).push_back(s < old ? s : -1);
 	}
+	reshape(oldNumStrats, sources);
 }
 
 // converts a sequence of strategies into the index in a stack of payoff arrays that correspond to that sequence
 template <typename T>
-int simGame<T>::rHash(vector<int> rationalityProfile)
+int simGame<T>::rHash(const vector<int> &rationalityProfile)
 {	
 	// sum_{i = 2}^{nP} maxR^{i - 1} * r_i
 	int num = 0, product = 0;
@@ -4740,7 +4751,7 @@ vector<int> simGame<T>::rUnhash(int matrixIndex)
 
 // save k-matrix to be displayed in LaTeX
 template <typename T>
-void simGame<T>::saveKMatrixAsLatex(vector<int> choices, vector<double> EU)
+void simGame<T>::saveKMatrixAsLatex(const vector<int> &choices, const vector<double> &EU)
 {
 	int val = -std::numeric_limits<T>::max();
 	LinkedList<T>* curList;
@@ -4907,7 +4918,7 @@ void simGame<T>::savePayoffMatrixAsLatex()
 			{
 				if (m == 0)
 					outfile << "\\noindent\n";
-				profile = unhash(m);
+				unhash(m, profile);
 				outfile << "$";
 				if (numPlayers == 3)
 					outfile << "(c_3) = (";
@@ -5056,14 +5067,15 @@ void simGame<T>::saveToFile()
 template <typename T>
 void simGame<T>::setAllNumStrats(char impartial)
 {
-	int nS = -1, size = 1;
+	int nS = -1;
+	vector<int> numStrats = vector<int>(numPlayers);
 	
 	cout << "Enter the size of each player's strategy set.  ";
 	if(impartial == 'y')
 	{
 		cin >> nS;
 		for (int x = 0; x < numPlayers; x++)
-			players.at(x)->setNumStrats(nS);
+			numStrats.at(x) = nS;
 	}
 	else
 	{
@@ -5071,19 +5083,31 @@ void simGame<T>::setAllNumStrats(char impartial)
 		{
 			cout << "P_" << x << ": ";
 			cin >> nS;
-			players.at(x)->setNumStrats(nS);
+			numStrats.at(x) = nS;
 		}
 	}
+	setAllNumStrats(numStrats);
+}
+
+// resize every player's strategy set and start over with payoffs of 0
+template <typename T>
+void simGame<T>::setAllNumStrats(const vector<int> &numStrats)
+{
+	int size = 1;
 	
-	// Creating the payoff matrix
-	size = 1;
-	if (numPlayers > 2)
-	{
-		for (int x = 0; x < numPlayers; x++)
-			size *= players.at(x)->getNumStrats();
-	}
+	// every list is replaced, so drop them all at once
+	payoffMatrix.clear();
+	listPool.clear();
+	nodePool.clear();
 	
-	payoffMatrix.resize(size);
+	for (int x = 0; x < numPlayers; x++)
+		players.at(x)->setNumStrats(numStrats.at(x));
+	
+	// Creating the payoff matrix, one for each profile of P_3,...,P_n
+	for (int x = 2; x < numPlayers; x++)
+		size *= players.at(x)->getNumStrats();
+	
+	payoffMatrix = vector<vector<vector<LinkedList<T>*> > >(size);
 	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
 	{
 		payoffMatrix.at(m).resize(players.at(0)->getNumStrats());
@@ -5092,13 +5116,16 @@ void simGame<T>::setAllNumStrats(char impartial)
 			payoffMatrix.at(m).at(i).resize(players.at(1)->getNumStrats());
 			for (int j = 0; j < players.at(1)->getNumStrats(); j++)
 			{
-				LinkedList<T>* newList = new LinkedList<T>;
+				LinkedList<T>* newList = listPool.create(&nodePool);
 				for (int x = 0; x < numPlayers; x++)
 					newList->appendNode(0, false);
 				payoffMatrix.at(m).at(i).at(j) = newList; // head is he first node of the list in payoffMatrix.at(0).at(i).at(j)
 			}
 		}
 	}
+	computeNumOutcomes();
+	computeImpartiality();
+	shapeChanged();
 }
 
 // set rationalities for all players
@@ -5117,100 +5144,25 @@ void simGame<T>::setAllRationalities()
 	}
 }
 
-// Stag Hunt relation between equilibria
+/*
+	P_x's payoff at a strategy profile. Goes through updateBestResponses(), so a single 
+	edit to an analyzed game patches its slice, and while a game is being filled in 
+	(best responses not current) each call only marks P_x's payoffs as changed.
+*/
 template <typename T>
-bool simGame<T>::shCondition(vector<int> eq1, vector<int> eq2)
+void simGame<T>::setPayoff(const vector<int> &profile, int x, T value)
 {
-	int X = payoffMatrix.at(hash(eq1)).at(eq1.at(0)).at(eq1.at(1))->getNodeValue(0);
-	int Y = payoffMatrix.at(hash(eq1)).at(eq1.at(0)).at(eq1.at(1))->getNodeValue(1);
-	int W = payoffMatrix.at(hash(eq2)).at(eq2.at(0)).at(eq2.at(1))->getNodeValue(0);
-	int Z = payoffMatrix.at(hash(eq2)).at(eq2.at(0)).at(eq2.at(1))->getNodeValue(1);
-	
-	// ensuring equal payoffs for the guaranteed strategies
-	if (X > W)
-	{
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-		{
-			if (payoffMatrix.at(hash(eq2)).at(i).at(eq2.at(1))->getNodeValue(1) != Z)
-				return false;
-		}
-		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-		{
-			if (payoffMatrix.at(hash(eq2)).at(eq2.at(0)).at(j)->getNodeValue(0) != W)
-				return false;
-		}
-		
-		// U < W < X
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-		{
-			if (i != eq1.at(0) && i != eq2.at(0))
-			{
-				if (payoffMatrix.at(hash(eq2)).at(i).at(eq2.at(1))->getNodeValue(0) == W || payoffMatrix.at(hash(eq1)).at(i).at(eq1.at(1))->getNodeValue(0) == X)
-					return false;
-			}
-		}
-		
-		// V < Z < Y
-		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-		{
-			if (j != eq1.at(1) && j != eq2.at(1))
-			{
-				if (payoffMatrix.at(hash(eq2)).at(eq2.at(0)).at(j)->getNodeValue(1) == Z || payoffMatrix.at(hash(eq1)).at(eq1.at(0)).at(j)->getNodeValue(1) == Y)
-					return false;
-			}
-		}
-		
-	}
-	else // X <= W
-	{
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-		{
-			if (payoffMatrix.at(0).at(i).at(eq1.at(1))->getNodeValue(1) != Y)
-				return false;
-		}
-		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-		{
-			if (payoffMatrix.at(0).at(eq1.at(0)).at(j)->getNodeValue(0) != X)
-				return false;
-		}
-		
-		// U < X < W
-		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
-		{
-			if (i != eq1.at(0) && i != eq2.at(0))
-			{
-				if (payoffMatrix.at(0).at(i).at(eq1.at(1))->getNodeValue(0) == X || payoffMatrix.at(0).at(i).at(eq2.at(1))->getNodeValue(0) == W)
-					return false;
-			}
-		}
-		
-		// V < Y < Z
-		for (int j = 0; j < players.at(1)->getNumStrats(); j++)
-		{
-			if (j != eq1.at(1) && j != eq2.at(1))
-			{
-				if (payoffMatrix.at(0).at(eq1.at(0)).at(j)->getNodeValue(1) == Y || payoffMatrix.at(0).at(eq2.at(0)).at(j)->getNodeValue(1) == Z)
-					return false;
-			}
-		}
-	}
+	payoffMatrix.at(hash(profile)).at(profile.at(0)).at(profile.at(1))->setNodeValue(x, value);
+	updateBestResponses(x, profile);
+}
 
-	/*
-		  A  |  B
-	A | X, Y | U, Z
-	B | W, V | W, Z
-	W \le Z < X \le Y
-	...
-	I.e., W,Z < X,Y; i.e., U < W < X and V < Z < Y
-	*/
-	// if ((W <= Z && Z < Y && Y <= X) || (Z <= W && W < Y && Y <= X))
-	if (W < X && Z < Y)
-		return true;
-	// else if ((W <= Z && Z < X && X <= Y) || (Z <= W && W < X && X <= Y))
-	else if (X < W && Y < Z)
-		return true;
-	else
-		return false;
+// players or strategies were added or removed, so every cached result is stale
+template <typename T>
+void simGame<T>::shapeChanged()
+{
+	version++;
+	payoffVersions = vector<unsigned long>(numPlayers, version);
+	bestResponseVersions = vector<unsigned long>(numPlayers, 0);
 }
 
 // solve polynomial equation for x
@@ -5285,35 +5237,305 @@ double simGame<T>::solve(Polynomial* p1, Polynomial* p2)
 	}
 }
 
+// analyzes the game if needed and records the results under its content hash
+template <typename T>
+void simGame<T>::storeAnalysis(AnalysisCache &cache)
+{
+	CachedAnalysis result;
+	
+	computePureEquilibria();
+	determineType();
+	computeKStrategies();
+	
+	result.numStrats = vector<int>(numPlayers);
+	for (int x = 0; x < numPlayers; x++)
+		result.numStrats.at(x) = players.at(x)->getNumStrats();
+	result.payoffs = exactPayoffs();
+	result.pureEquilibria = pureEquilibria;
+	result.paretoPureEquilibria = paretoPureEquilibria;
+	
+	result.types = vector<bool>(8);
+	result.types.at(0) = null;
+	result.types.at(1) = zs;
+	result.types.at(2) = ih;
+	result.types.at(3) = pd;
+	result.types.at(4) = pc;
+	result.types.at(5) = bos;
+	result.types.at(6) = chicken;
+	result.types.at(7) = sh;
+	
+	result.kStrategies = kStrategies;
+	cache.insert(contentHash(), result);
+}
+
+/*
+	P_x's payoff at profile changed. Only P_x's best responses along the slice through 
+	profile (profile with P_x's strategy varied) can change, so if the rest were current, 
+	that slice is recomputed and the pure equilibria are patched for the profiles in it. 
+	Costs O(numStrats_x) instead of O(numOutcomes). Otherwise everything for P_x is 
+	recomputed when next needed.
+*/
+template <typename T>
+void simGame<T>::updateBestResponses(int x, vector<int> profile)
+{
+	bool bestResponsesCurrent = (bestResponseVersions.at(x) == payoffVersions.at(x));
+	bool equilibriaCurrent = (equilibriaVersion == version); // every player's best responses were current
+	
+	payoffsChanged(x);
+	if (!bestResponsesCurrent)
+		return;
+	
+	vector<LinkedList<T>*> slice = vector<LinkedList<T>*>(players.at(x)->getNumStrats());
+	for (int s = 0; s < players.at(x)->getNumStrats(); s++)
+	{
+		profile.at(x) = s;
+		slice.at(s) = payoffMatrix.at(hash(profile)).at(profile.at(0)).at(profile.at(1));
+	}
+	
+	T maxValue = slice.at(0)->getNodeValue(x);
+	for (int s = 1; (unsigned)s < slice.size(); s++)
+	{
+		if (slice.at(s)->getNodeValue(x) > maxValue)
+			maxValue = slice.at(s)->getNodeValue(x);
+	}
+	for (int s = 0; (unsigned)s < slice.size(); s++)
+		slice.at(s)->setNodeBestResponse(x, slice.at(s)->getNodeValue(x) == maxValue);
+	bestResponseVersions.at(x) = payoffVersions.at(x);
+	
+	if (!equilibriaCurrent)
+		return;
+	
+	// drop the equilibria in the slice, then add back the ones that still are
+	vector<vector<int> > kept;
+	for (int e = 0; (unsigned)e < pureEquilibria.size(); e++)
+	{
+		vector<int> other = pureEquilibria.at(e);
+		other.at(x) = profile.at(x);
+		if (other != profile)
+			kept.push_back(pureEquilibria.at(e));
+	}
+	pureEquilibria = kept;
+	
+	for (int s = 0; (unsigned)s < slice.size(); s++)
+	{
+		bool isEquilibrium = true;
+		for (int y = 0; y < numPlayers && isEquilibrium; y++)
+		{
+			if (!slice.at(s)->getNodeBestResponse(y))
+				isEquilibrium = false;
+		}
+		if (isEquilibrium)
+		{
+			profile.at(x) = s;
+			int e = pureEquilibria.size();
+			while (e > 0 && lessThanProfile(profile, pureEquilibria.at(e - 1)))
+				e--;
+			pureEquilibria.insert(pureEquilibria.begin() + e, profile);
+		}
+	}
+	equilibriaVersion = version;
+}
+
 // converts an index in a stack of payoff arrays into the sequence of strategies that produce that index
 template <typename T>
 vector<int> simGame<T>::unhash(int m)
 {
-	int choice = 0;
-	int previousValues = 0; // values from players below P_x
-	int productNumStrats = 1;
-	vector<int> profile = vector<int>(numPlayers);
+	vector<int> profile;
+	unhash(m, profile);
+	return profile;
+}
+
+// same, written into profile so loops over the matrices can reuse one vector
+template <typename T>
+void simGame<T>::unhash(int m, vector<int> &profile)
+{
+	profile.resize(numPlayers);
 	profile.at(0) = -1;
 	profile.at(1) = -1;
 	
-	for (int x = 2; x < numPlayers - 1; x++)
-		productNumStrats *= players.at(x)->getNumStrats();
+	// m = c_2 + nS_2 * (c_3 + nS_3 * (c_4 + ...)), the inverse of hash()
+	for (int x = 2; x < numPlayers; x++)
+	{
+		profile.at(x) = m % players.at(x)->getNumStrats();
+		m /= players.at(x)->getNumStrats();
+	}
+}
+
+/*
+	{"record":"outcome","profile":[0,1],"payoffs":[3,2],"bestResponses":[1,0]}
+	...
+	every outcome, matrix by matrix like printBestResponses(), with 1 where P_x's payoff
+	is a best response. Strategies are numbered from 0 in every write function.
+*/
+template <typename T>
+void simGame<T>::writeBestResponses(ResultWriter &writer)
+{
+	vector<int> profile = vector<int>(numPlayers);
+	vector<double> payoffs = vector<double>(numPlayers);
+	vector<int> bestResponses = vector<int>(numPlayers);
 	
-	for (int x = numPlayers - 1; x > 1; x--)
+	computePureEquilibria(); // calls computeBestResponses()
+	for (int m = 0; (unsigned)m < payoffMatrix.size(); m++)
+	{
+		unhash(m, profile);
+		for (int i = 0; i < players.at(0)->getNumStrats(); i++)
+		{
+			for (int j = 0; j < players.at(1)->getNumStrats(); j++)
+			{
+				LinkedList<T>* curList = payoffMatrix.at(m).at(i).at(j);
+				profile.at(0) = i;
+				profile.at(1) = j;
+				for (int x = 0; x < numPlayers; x++)
+				{
+					payoffs.at(x) = static_cast<double>(curList->getNodeValue(x));
+					bestResponses.at(x) = curList->getNodeBestResponse(x);
+				}
+				
+				writer.beginRecord("outcome");
+				writer.addField("profile", profile);
+				writer.addField("payoffs", payoffs);
+				writer.addField("bestResponses", bestResponses);
+				writer.endRecord();
+			}
+		}
+	}
+}
+
+/*
+	{"record":"expectedUtilityTerm","player":0,"strategy":1,"term":0,"coefficient":4,"exponents":[1]}
+	...
+	the terms of computeMixedStrategies()'s expected utilities, for two-player games
+*/
+template <typename T>
+void simGame<T>::writeExpectedUtilities(ResultWriter &writer)
+{
+	if (numPlayers > 2)
+	{
+		cout << "ERROR: expected utilities can only be written for two-player games\n";
+		return;
+	}
+	
+	vector<vector<Polynomial*> > EU = computeExpectedUtilities();
+	for (int x = 0; x < numPlayers; x++)
+	{
+		for (int s = 0; (unsigned)s < EU.at(x).size(); s++)
+		{
+			for (int t = 0; t < EU.at(x).at(s)->getNumTerms(); t++)
+			{
+				writer.beginRecord("expectedUtilityTerm");
+				writer.addField("player", x);
+				writer.addField("strategy", s);
+				writer.addField("term", t);
+				writer.addField("coefficient", EU.at(x).at(s)->getCoefficient(t));
+				writer.addField("exponents", EU.at(x).at(s)->getExponents(t));
+				writer.endRecord();
+			}
+		}
+	}
+}
+
+/*
+	{"record":"kStrategy","level":0,"strategies":[1,0]}
+	...
+	what each player plays at rationality levels 0 through 3
+*/
+template <typename T>
+void simGame<T>::writeKStrategies(ResultWriter &writer)
+{
+	computeKStrategies();
+	for (int r = 0; (unsigned)r < kStrategies.size(); r++)
+	{
+		writer.beginRecord("kStrategy");
+		writer.addField("level", r);
+		writer.addField("strategies", kStrategies.at(r));
+		writer.endRecord();
+	}
+}
+
+/*
+	{"record":"player","player":0,"rationality":2,"numStrats":3,"choice":1}
+	...
+	choice is -1 until the game has been analyzed
+*/
+template <typename T>
+void simGame<T>::writePlayers(ResultWriter &writer) const
+{
+	for (int x = 0; x < numPlayers; x++)
+	{
+		writer.beginRecord("player");
+		writer.addField("player", x);
+		writer.addField("rationality", players.at(x)->getRationality());
+		writer.addField("numStrats", players.at(x)->getNumStrats());
+		writer.addField("choice", players.at(x)->getChoice());
+		writer.endRecord();
+	}
+}
+
+/*
+	{"record":"pureEquilibrium","profile":[0,1],"payoffs":[3,2],"paretoOptimal":true}
+	...
+*/
+template <typename T>
+void simGame<T>::writePureEquilibria(ResultWriter &writer)
+{
+	vector<double> payoffs = vector<double>(numPlayers);
+	
+	computePureEquilibria();
+	for (int e = 0; (unsigned)e < pureEquilibria.size(); e++)
 	{
-		choice = 0;
-		while (productNumStrats * choice + previousValues < m 
-				&& choice != players.at(x)->getNumStrats() - 1)
-			choice++;
+		const vector<int> &profile = pureEquilibria.at(e);
+		LinkedList<T>* curList = payoffMatrix.at(hash(profile)).at(profile.at(0)).at(profile.at(1));
+		for (int x = 0; x < numPlayers; x++)
+			payoffs.at(x) = static_cast<double>(curList->getNodeValue(x));
 		
-		if (productNumStrats * choice + previousValues > m)
-			choice--;
+		bool paretoOptimal = find(paretoPureEquilibria.begin(), paretoPureEquilibria.end(), profile) != paretoPureEquilibria.end();
 		
-		previousValues += productNumStrats * choice;
-		profile.at(x) = choice;
-		productNumStrats = productNumStrats / players.at(x)->getNumStrats();
-	}	
-	return profile;
+		writer.beginRecord("pureEquilibrium");
+		writer.addField("profile", profile);
+		writer.addField("payoffs", payoffs);
+		writer.addField("paretoOptimal", paretoOptimal);
+		writer.endRecord();
+	}
+}
+
+/*
+	{"record":"game","numPlayers":2,"numStrats":[2,2],"numOutcomes":4,"type":"pd"}
+	then the players, pure equilibria, k-strategies and every outcome's best responses.
+	Nothing goes through the column-width scans the print functions use.
+*/
+template <typename T>
+void simGame<T>::writeResults(ResultWriter &writer)
+{
+	vector<int> numStrats = vector<int>(numPlayers);
+	string type = "";
+	
+	computePureEquilibria();
+	determineType();
+	isMixed();
+	for (int x = 0; x < numPlayers; x++)
+		numStrats.at(x) = players.at(x)->getNumStrats();
+	
+	// same order as determineType()
+	const char* names[] = {"null", "zs", "ih", "pd", "pc", "bos", "chicken", "sh"};
+	bool flags[] = {null, zs, ih, pd, pc, bos, chicken, sh};
+	for (int n = 0; n < 8; n++)
+	{
+		if (flags[n])
+			type += (type.empty() ? "" : " ") + string(names[n]);
+	}
+	
+	writer.beginRecord("game");
+	writer.addField("numPlayers", numPlayers);
+	writer.addField("numStrats", numStrats);
+	writer.addField("numOutcomes", numOutcomes);
+	writer.addField("type", type);
+	writer.endRecord();
+	
+	writePlayers(writer);
+	writePureEquilibria(writer);
+	writeKStrategies(writer);
+	writeBestResponses(writer);
+	writer.flush();
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,517 @@
+/*************************************************
+Title: SymmetricGame.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: compact storage and equilibria for
+		 symmetric games
+**************************************************/
+
+#ifndef SYMMETRICGAME_H
+#define SYMMETRICGAME_H
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "SimGame.h"
+
+/*
+	A game where every player has the same strategies and a player's payoff only
+	depends on their own strategy and how many of the others play each strategy. That
+	makes a payoff per (own strategy, opponent count vector) enough: numStrats times
+	C(numPlayers + numStrats - 2, numStrats - 1) entries instead of numPlayers times
+	numStrats^numPlayers. For 10 players and 5 strategies that's 3575 entries in place of
+	about 10^8.
+
+	Count vectors are ranked in lexicographic order with a table of how many vectors
+	come before each (position, amount left, count), so a lookup is one pass over the
+	vector. A whole game's count classes of pure profiles are enumerated the same way.
+*/
+template <typename T>
+class SymmetricGame
+{
+	private:
+		int numPlayers;
+		int numStrats;
+		int numCounts; // opponent count vectors
+		vector<T> payoffs; // own strategy major: s * numCounts + rank
+		vector<int> counts; // every opponent count vector in rank order, flat
+		vector<double> logCoefficients; // log of each opponent count vector's multinomial coefficient
+		vector<int> offsets; // vectors before (position i, m left, count c) at (i * (m_max + 1) + m) * (m_max + 1) + c
+
+		void init(int, int);
+		bool nextCounts(vector<int> &) const;
+		void printCounts(const vector<int> &) const;
+	public:
+		SymmetricGame(int, int);
+		SymmetricGame(simGame<T>*);
+
+		int getNumCounts() const							{ return numCounts; }
+		int getNumEntries() const							{ return payoffs.size(); }
+		int getNumPlayers() const							{ return numPlayers; }
+		int getNumStrats() const							{ return numStrats; }
+		T getPayoff(int s, const vector<int> &opp) const	{ return payoffs.at(s * numCounts + rank(opp)); }
+
+		void setPayoff(int s, const vector<int> &opp, T value)	{ payoffs.at(s * numCounts + rank(opp)) = value; }
+
+		vector<double> computeExpectedPayoffs(const vector<double> &) const;
+		vector<vector<int> > computePureEquilibria() const;
+		double computeRegret(const vector<double> &) const;
+		vector<vector<double> > computeSymmetricEquilibria(double) const;
+		T getPayoff(const vector<int> &, int) const;
+		void printPureEquilibria() const;
+		void printSymmetricEquilibria() const;
+		void randGame();
+		int rank(const vector<int> &) const;
+		simGame<T>* toSimGame() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, payoffs start at 0
+template <typename T>
+SymmetricGame<T>::SymmetricGame(int nP, int nS)
+{
+	init(nP, nS);
+}
+
+/*
+	constructor, copies a simGame if it's symmetric: P_x's payoff at a profile has to
+	equal P_1's with P_x's strategy and P_1's swapped
+*/
+template <typename T>
+SymmetricGame<T>::SymmetricGame(simGame<T>* game)
+{
+	numPlayers = 0;
+	numStrats = 0;
+	numCounts = 0;
+
+	GameFeatures<T> features = game->computeFeatures();
+	int nP = game->getNumPlayers();
+	for (int x = 1; x < nP; x++)
+	{
+		if (features.getNumStrats(x) != features.getNumStrats(0))
+		{
+			cout << "ERROR: every player needs the same number of strategies for a symmetric game\n";
+			return;
+		}
+	}
+
+	for (int o = 0; o < features.getNumOutcomes(); o++)
+	{
+		vector<int> prof = features.profile(o);
+		for (int x = 1; x < nP; x++)
+		{
+			vector<int> swapped = prof;
+			swap(swapped.at(0), swapped.at(x));
+			if (features.getPayoff(o, x) != features.getPayoff(features.outcome(swapped), 0))
+			{
+				cout << "ERROR: the game isn't symmetric\n";
+				return;
+			}
+		}
+		// P_1's payoff can't depend on which opponents play what, only how many
+		vector<int> sorted = prof;
+		sort(sorted.begin() + 1, sorted.end());
+		if (features.getPayoff(o, 0) != features.getPayoff(features.outcome(sorted), 0))
+		{
+			cout << "ERROR: the game isn't symmetric\n";
+			return;
+		}
+	}
+
+	init(nP, features.getNumStrats(0));
+	for (int o = 0; o < features.getNumOutcomes(); o++)
+	{
+		vector<int> prof = features.profile(o);
+		vector<int> opp = vector<int>(numStrats, 0);
+		for (int x = 1; x < nP; x++)
+			opp.at(prof.at(x))++;
+		setPayoff(prof.at(0), opp, features.getPayoff(o, 0));
+	}
+}
+
+/*
+	Expected payoff of each strategy when everyone else plays p independently. The
+	opponents' counts are multinomial, so each count vector's probability is its
+	coefficient times a product of powers, computed once and shared by every strategy.
+*/
+template <typename T>
+vector<double> SymmetricGame<T>::computeExpectedPayoffs(const vector<double> &p) const
+{
+	vector<double> expected = vector<double>(numStrats, 0.0);
+	vector<double> logP = vector<double>(numStrats);
+
+	for (int j = 0; j < numStrats; j++)
+		logP.at(j) = (p.at(j) > 0.0) ? log(p.at(j)) : -INFINITY;
+
+	for (int r = 0; r < numCounts; r++)
+	{
+		double logProbability = logCoefficients.at(r);
+		for (int j = 0; j < numStrats; j++)
+		{
+			if (counts.at(r * numStrats + j) > 0)
+				logProbability += counts.at(r * numStrats + j) * logP.at(j);
+		}
+		if (logProbability == -INFINITY)
+			continue;
+
+		double probability = exp(logProbability);
+		for (int s = 0; s < numStrats; s++)
+			expected.at(s) += probability * static_cast<double>(payoffs.at(s * numCounts + r));
+	}
+	return expected;
+}
+
+/*
+	Pure equilibria up to renaming the players: each is how many players play each
+	strategy. A count vector is an equilibrium if nobody playing s gains by switching,
+	with the others' counts being the vector minus that player.
+*/
+template <typename T>
+vector<vector<int> > SymmetricGame<T>::computePureEquilibria() const
+{
+	vector<vector<int> > equilibria;
+	vector<int> all = vector<int>(numStrats, 0);
+
+	if (numPlayers == 0)
+		return equilibria;
+	all.at(numStrats - 1) = numPlayers;
+	do
+	{
+		bool equilibrium = true;
+		for (int s = 0; s < numStrats && equilibrium; s++)
+		{
+			if (all.at(s) == 0)
+				continue;
+			all.at(s)--;
+			int r = rank(all);
+			for (int t = 0; t < numStrats; t++)
+			{
+				if (payoffs.at(t * numCounts + r) > payoffs.at(s * numCounts + r))
+				{
+					equilibrium = false;
+					break;
+				}
+			}
+			all.at(s)++;
+		}
+		if (equilibrium)
+			equilibria.push_back(all);
+	} while (nextCounts(all));
+	return equilibria;
+}
+
+// how much better the best pure strategy does than p against everyone else playing p
+template <typename T>
+double SymmetricGame<T>::computeRegret(const vector<double> &p) const
+{
+	vector<double> expected = computeExpectedPayoffs(p);
+	double best = expected.at(0), average = 0.0;
+
+	for (int s = 0; s < numStrats; s++)
+	{
+		average += p.at(s) * expected.at(s);
+		if (expected.at(s) > best)
+			best = expected.at(s);
+	}
+	return best - average;
+}
+
+/*
+	Symmetric equilibria, where everyone plays the same mixed strategy, up to regret eps.
+	With 2 strategies every one is found: the pure ones are checked directly, and the
+	interior ones are the roots of the payoff difference, bracketed on a grid and
+	bisected. With more strategies, replicator dynamics are run from the uniform
+	strategy and from random starts, keeping whatever ends within eps. Nash showed one
+	always exists, but the dynamics can cycle and miss it.
+*/
+template <typename T>
+vector<vector<double> > SymmetricGame<T>::computeSymmetricEquilibria(double eps) const
+{
+	vector<vector<double> > equilibria;
+
+	if (numPlayers == 0)
+		return equilibria;
+	for (int s = 0; s < numStrats; s++)
+	{
+		vector<double> pure = vector<double>(numStrats, 0.0);
+		pure.at(s) = 1.0;
+		if (computeRegret(pure) <= eps)
+			equilibria.push_back(pure);
+	}
+
+	if (numStrats == 2)
+	{
+		const int gridSize = 1000;
+		double previous = 0.0;
+		for (int g = 0; g <= gridSize; g++)
+		{
+			double q = (double)g / gridSize;
+			vector<double> expected = computeExpectedPayoffs({q, 1.0 - q});
+			double difference = expected.at(0) - expected.at(1);
+			if (g > 0 && g < gridSize && difference == 0.0)
+				equilibria.push_back({q, 1.0 - q});
+			else if (g > 0 && ((previous < 0.0 && difference > 0.0) || (previous > 0.0 && difference < 0.0)))
+			{
+				double low = (double)(g - 1) / gridSize, high = q;
+				for (int step = 0; step < 60; step++)
+				{
+					double middle = (low + high) / 2.0;
+					expected = computeExpectedPayoffs({middle, 1.0 - middle});
+					if ((expected.at(0) - expected.at(1) > 0.0) == (difference > 0.0))
+						high = middle;
+					else
+						low = middle;
+				}
+				equilibria.push_back({(low + high) / 2.0, 1.0 - (low + high) / 2.0});
+			}
+			previous = difference;
+		}
+		return equilibria;
+	}
+
+	// background fitness making every payoff positive for the discrete replicator
+	double minPayoff = static_cast<double>(payoffs.at(0));
+	for (int e = 1; (unsigned)e < payoffs.size(); e++)
+	{
+		if (static_cast<double>(payoffs.at(e)) < minPayoff)
+			minPayoff = static_cast<double>(payoffs.at(e));
+	}
+	double background = 1.0 - minPayoff;
+
+	mt19937 generator(0);
+	exponential_distribution<double> exponential(1.0);
+	for (int start = 0; start < 20; start++)
+	{
+		vector<double> p = vector<double>(numStrats, 1.0 / numStrats);
+		if (start > 0)
+		{
+			double total = 0.0;
+			for (int s = 0; s < numStrats; s++)
+			{
+				p.at(s) = exponential(generator);
+				total += p.at(s);
+			}
+			for (int s = 0; s < numStrats; s++)
+				p.at(s) /= total;
+		}
+
+		for (int step = 0; step < 10000 && computeRegret(p) > eps / 10.0; step++)
+		{
+			vector<double> expected = computeExpectedPayoffs(p);
+			double average = 0.0;
+			for (int s = 0; s < numStrats; s++)
+				average += p.at(s) * expected.at(s);
+			for (int s = 0; s < numStrats; s++)
+				p.at(s) *= (expected.at(s) + background) / (average + background);
+		}
+		if (computeRegret(p) > eps)
+			continue;
+
+		bool found = false;
+		for (int e = 0; (unsigned)e < equilibria.size() && !found; e++)
+		{
+			double distance = 0.0;
+			for (int s = 0; s < numStrats; s++)
+				distance += fabs(equilibria.at(e).at(s) - p.at(s));
+			found = distance < 1e-3;
+		}
+		if (!found)
+			equilibria.push_back(p);
+	}
+	return equilibria;
+}
+
+// P_x's payoff at a full strategy profile
+template <typename T>
+T SymmetricGame<T>::getPayoff(const vector<int> &profile, int x) const
+{
+	vector<int> opp = vector<int>(numStrats, 0);
+	for (int y = 0; y < numPlayers; y++)
+	{
+		if (y != x)
+			opp.at(profile.at(y))++;
+	}
+	return getPayoff(profile.at(x), opp);
+}
+
+template <typename T>
+void SymmetricGame<T>::init(int nP, int nS)
+{
+	int m = nP - 1;
+	numPlayers = nP;
+	numStrats = nS;
+
+	// comb.at(a).at(b) = a choose b
+	vector<vector<long long> > comb = vector<vector<long long> >(m + nS + 1, vector<long long>(nS + 1, 0));
+	for (int a = 0; (unsigned)a < comb.size(); a++)
+	{
+		comb.at(a).at(0) = 1;
+		for (int b = 1; b <= nS && b <= a; b++)
+			comb.at(a).at(b) = comb.at(a - 1).at(b - 1) + (b < a ? comb.at(a - 1).at(b) : 0);
+	}
+
+	// vectors of length nS - i summing to left with a first count below c
+	offsets = vector<int>(nS * (m + 1) * (m + 1), 0);
+	for (int i = 0; i < nS - 1; i++)
+		for (int left = 0; left <= m; left++)
+			for (int c = 1; c <= left; c++)
+				offsets.at((i * (m + 1) + left) * (m + 1) + c) = offsets.at((i * (m + 1) + left) * (m + 1) + c - 1)
+																+ comb.at(left - (c - 1) + nS - i - 2).at(nS - i - 2);
+
+	numCounts = comb.at(m + nS - 1).at(nS - 1);
+	payoffs = vector<T>(nS * numCounts, T(0));
+	counts = vector<int>(nS * numCounts);
+	logCoefficients = vector<double>(numCounts);
+
+	vector<int> opp = vector<int>(nS, 0);
+	opp.at(nS - 1) = m;
+	int r = 0;
+	do
+	{
+		logCoefficients.at(r) = lgamma(m + 1.0);
+		for (int j = 0; j < nS; j++)
+		{
+			counts.at(r * nS + j) = opp.at(j);
+			logCoefficients.at(r) -= lgamma(opp.at(j) + 1.0);
+		}
+		r++;
+	} while (nextCounts(opp));
+}
+
+/*
+	lexicographically next vector with the same total, false after the last one: the
+	rightmost count before the last with something after it goes up by 1, and
+	everything after it moves to the last count
+*/
+template <typename T>
+bool SymmetricGame<T>::nextCounts(vector<int> &c) const
+{
+	int tail = c.back();
+	for (int i = c.size() - 2; i >= 0; i--)
+	{
+		if (tail > 0)
+		{
+			c.at(i)++;
+			for (int j = i + 1; (unsigned)j < c.size() - 1; j++)
+				c.at(j) = 0;
+			c.back() = tail - 1;
+			return true;
+		}
+		tail += c.at(i);
+	}
+	return false;
+}
+
+// (3 s_1, 7 s_2)
+template <typename T>
+void SymmetricGame<T>::printCounts(const vector<int> &c) const
+{
+	bool first = true;
+	cout << "(";
+	for (int s = 0; s < numStrats; s++)
+	{
+		if (c.at(s) == 0)
+			continue;
+		if (!first)
+			cout << ", ";
+		cout << c.at(s) << " s_" << s + 1;
+		first = false;
+	}
+	cout << ")";
+}
+
+/*
+	Pure Equilibria (10 players, up to renaming them):  (3 s_1, 7 s_2), (10 s_2)
+*/
+template <typename T>
+void SymmetricGame<T>::printPureEquilibria() const
+{
+	vector<vector<int> > equilibria = computePureEquilibria();
+
+	cout << "\nPure Equilibria (" << numPlayers << " players, up to renaming them):  ";
+	if (equilibria.empty())
+		cout << "none";
+	for (int e = 0; (unsigned)e < equilibria.size(); e++)
+	{
+		printCounts(equilibria.at(e));
+		if ((unsigned)e < equilibria.size() - 1)
+			cout << ", ";
+	}
+	cout << endl;
+}
+
+/*
+	Symmetric Equilibria:
+	(0.25, 0.75)  regret 1.2e-12
+*/
+template <typename T>
+void SymmetricGame<T>::printSymmetricEquilibria() const
+{
+	vector<vector<double> > equilibria = computeSymmetricEquilibria(1e-6);
+
+	cout << "\nSymmetric Equilibria:\n";
+	if (equilibria.empty())
+		cout << "none found\n";
+	for (int e = 0; (unsigned)e < equilibria.size(); e++)
+	{
+		cout << "(";
+		for (int s = 0; s < numStrats; s++)
+		{
+			cout << equilibria.at(e).at(s);
+			if (s < numStrats - 1)
+				cout << ", ";
+		}
+		cout << ")  regret " << computeRegret(equilibria.at(e)) << endl;
+	}
+}
+
+// payoffs from 0 to 99, like simGame::randGame()
+template <typename T>
+void SymmetricGame<T>::randGame()
+{
+	for (int e = 0; (unsigned)e < payoffs.size(); e++)
+		payoffs.at(e) = rand() % 100;
+}
+
+// position of an opponent count vector among those with the same total
+template <typename T>
+int SymmetricGame<T>::rank(const vector<int> &opp) const
+{
+	int m = numPlayers - 1;
+	int left = m, r = 0;
+	for (int i = 0; i < numStrats - 1; i++)
+	{
+		r += offsets.at((i * (m + 1) + left) * (m + 1) + opp.at(i));
+		left -= opp.at(i);
+	}
+	return r;
+}
+
+// the full normal form, numStrats^numPlayers outcomes, so only for small games
+template <typename T>
+simGame<T>* SymmetricGame<T>::toSimGame() const
+{
+	simGame<T>* game = new simGame<T>(numPlayers);
+	vector<int> prof = vector<int>(numPlayers, 0);
+
+	game->setAllNumStrats(vector<int>(numPlayers, numStrats));
+	while (true)
+	{
+		for (int x = 0; x < numPlayers; x++)
+			game->setPayoff(prof, x, getPayoff(prof, x));
+
+		int x = 0;
+		while (x < numPlayers && prof.at(x) == numStrats - 1)
+		{
+			prof.at(x) = 0;
+			x++;
+		}
+		if (x == numPlayers)
+			break;
+		prof.at(x)++;
+	}
+	return game;
+}
+
+#endif
@@ -0,0 +1,201 @@
+/*************************************************
+Title: TaskScheduler.h
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: work-stealing task scheduler for the
+		 parallel solvers
+**************************************************/
+
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/*
+	Each worker has its own deque of tasks. A worker takes tasks from the back of its
+	own deque (most recently spawned first) and, when that is empty, steals from the
+	front of the others' deques, where the older and usually larger tasks are. A task
+	receives the index of the worker running it so it can spawn onto that worker's
+	deque. run() returns once every spawned task has finished. A worker that finds
+	every deque empty sleeps until a task is spawned or the last one finishes, so a
+	serial stretch of the work doesn't keep the other cores spinning.
+
+	Workers 1 to numThreads - 1 are started by the constructor and stay asleep between
+	runs until the destructor, so run() can be called once per round of a loop without
+	starting threads each time. The calling thread is worker 0 during run().
+*/
+class TaskScheduler
+{
+	private:
+		int numThreads;
+		vector<deque<function<void(int)> > > queues;
+		deque<mutex> locks; // one per queue
+		atomic<int> pending; // spawned but not finished
+		atomic<int> queued; // spawned but not taken
+		atomic<int> numSleeping;
+		mutex sleepLock;
+		condition_variable wake;
+		bool stopping; // guarded by sleepLock
+		vector<thread> threads;
+
+		void finishTask();
+		void serve(int);
+		bool takeTask(int, function<void(int)> &);
+		void work(int);
+	public:
+		TaskScheduler(int);
+		~TaskScheduler();
+
+		int getNumThreads() const	{ return numThreads; }
+
+		void run(function<void(int)>);
+		void spawn(int, function<void(int)>);
+
+		// number of threads to use when the caller asks for 0
+		static int defaultNumThreads()
+		{
+			int n = thread::hardware_concurrency();
+			return n > 0 ? n : 1;
+		}
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// constructor, n < 1 uses every hardware thread
+TaskScheduler::TaskScheduler(int n)
+{
+	numThreads = n < 1 ? defaultNumThreads() : n;
+	queues = vector<deque<function<void(int)> > >(numThreads);
+	locks.resize(numThreads);
+	pending = 0;
+	queued = 0;
+	numSleeping = 0;
+	stopping = false;
+	for (int w = 1; w < numThreads; w++)
+		threads.push_back(thread(&TaskScheduler::serve, this, w));
+}
+
+// destructor, wakes the workers to stop them
+TaskScheduler::~TaskScheduler()
+{
+	{
+		lock_guard<mutex> guard(sleepLock);
+		stopping = true;
+		wake.notify_all();
+	}
+	for (int t = 0; (unsigned)t < threads.size(); t++)
+		threads.at(t).join();
+}
+
+// the last task to finish wakes worker 0 so run() can return
+void TaskScheduler::finishTask()
+{
+	if (--pending == 0)
+	{
+		lock_guard<mutex> guard(sleepLock);
+		wake.notify_all();
+	}
+}
+
+// runs root on the calling thread as worker 0, with the other workers helping, until no tasks are left
+void TaskScheduler::run(function<void(int)> root)
+{
+	spawn(0, root);
+	work(0);
+}
+
+// a worker's whole life: take tasks while there are any, sleep while there aren't
+void TaskScheduler::serve(int worker)
+{
+	function<void(int)> task;
+	while (true)
+	{
+		if (takeTask(worker, task))
+		{
+			task(worker);
+			finishTask();
+		}
+		else
+		{
+			unique_lock<mutex> guard(sleepLock);
+			numSleeping++;
+			wake.wait(guard, [this] { return queued > 0 || stopping; });
+			numSleeping--;
+			if (stopping)
+				return;
+		}
+	}
+}
+
+void TaskScheduler::spawn(int worker, function<void(int)> task)
+{
+	pending++;
+	{
+		lock_guard<mutex> guard(locks.at(worker));
+		queues.at(worker).push_back(task);
+	}
+	queued++;
+
+	// a sleeper counted after queued went up sees the task before it waits
+	if (numSleeping > 0)
+	{
+		lock_guard<mutex> guard(sleepLock);
+		wake.notify_one();
+	}
+}
+
+// own deque from the back, then the others' from the front
+bool TaskScheduler::takeTask(int worker, function<void(int)> &task)
+{
+	for (int k = 0; k < numThreads; k++)
+	{
+		int victim = (worker + k) % numThreads;
+		lock_guard<mutex> guard(locks.at(victim));
+		if (!queues.at(victim).empty())
+		{
+			if (k == 0)
+			{
+				task = queues.at(victim).back();
+				queues.at(victim).pop_back();
+			}
+			else
+			{
+				task = queues.at(victim).front();
+				queues.at(victim).pop_front();
+			}
+			queued--;
+			return true;
+		}
+	}
+	return false;
+}
+
+// worker 0's loop during run(), which ends when the last task finishes
+void TaskScheduler::work(int worker)
+{
+	function<void(int)> task;
+	while (pending > 0)
+	{
+		if (takeTask(worker, task))
+		{
+			task(worker);
+			finishTask();
+		}
+		else
+		{
+			unique_lock<mutex> guard(sleepLock);
+			numSleeping++;
+			wake.wait(guard, [this] { return queued > 0 || pending == 0; });
+			numSleeping--;
+		}
+	}
+}
+
+#endif
@@ -11,6 +11,7 @@ Purpose: terms in Polynomial.h
 #include <iostream>
 #include <cmath>
 #include <vector>
+#include "NodePool.h"
 using namespace std;
 
 // list nodes (terms) of the form [coefficient, exponents]
@@ -20,6 +21,33 @@ struct Term
 	vector<int> exponents;
 	Term* next;
 	
+	/*
+		Terms are made and deleted constantly by Polynomial, so they come from a pool
+		instead of the heap. Polynomials aren't tied to a game, so the pool isn't either:
+		each thread has its own, which lives for the whole program so a term can be
+		deleted on a different thread than the one that made it.
+	*/
+	static NodePool<Term>& pool()	{ static thread_local NodePool<Term>* p = new NodePool<Term>; return *p; }
+	
+	static void* operator new(size_t size)
+	{
+		if (size != sizeof(Term))
+			return ::operator new(size);
+		return pool().allocate();
+	}
+	
+	static void operator delete(void* p, size_t size)
+	{
+		if (!p)
+			return;
+		if (size != sizeof(Term))
+		{
+			::operator delete(p);
+			return;
+		}
+		pool().deallocate(p);
+	}
+	
 	void printTerm()
 	{
 		cout << "\nPRINTTERM\n";
@@ -9,119 +9,68 @@ Purpose: class for sequential game tree nodes
 #define TREENODE_H
 #include "Player.h"
 
-// tree node for search tree (payoff tree)
+/*
+	Node in SeqGame's flat array. Nodes refer to each other by index: the branches
+	are the contiguous range [firstChild, firstChild + numChildren), and the parent
+	index is used to rebuild paths. Leaf payoffs live in SeqGame's payoff pool at
+	payoffIndex. Absent branches (skipped by insert) are kept as placeholders so
+	that ranges stay contiguous. Nodes sharing an information set label can't be told
+	apart by the player moving there.
+*/
 class TreeNode
 {
 	private:
-		template <typename T>
-		struct ListNode // hold payoffs
-		{
-			T value;
-			bool bestResponse; // for comparing root nodes
-			ListNode* next;
-		};
-		int strategy; // for ordering the tree
-		int level; // for internal nodes
-		int player = level % 2; // for internal nodes
-		ListNode<int>* payoff;
-		vector<TreeNode*> next; // numStrategies branches coming off the internal nodes
-		vector<int> path = vector<int>(level);
+		int parent; // -1 at the root
+		int firstChild;
+		int numChildren;
+		int level;
+		int player; // who moves here, -1 for a placeholder
+		int payoffIndex; // start of the leaf's payoffs in the pool, -1 if none
+		int choice; // strategy the node's player picks in the SPE, -1 at leaves
+		int infoSet; // information set label, -1 if the node is alone in its information set
 	public:
 		TreeNode()
 		{
-			this->strategy = 0;
-			this->level = 0;
-			this->player = level % 2;
-			this->payoff = new ListNode<int>;
-			this->payoff = NULL;
-			
-			this->next = vector<TreeNode*>(1);
-			
-			// next = vector<TreeNode*>(players[player]->getNumStrategies());
-			// for (int i = 0; i < players[player]->getNumStrategies(); i++)
-				// next.at(i) = NULL;
-			
-			for (int i = 0; i < level; i++)
-				path.at(i) = -1;
-		}
-		
-		TreeNode(int s, ListNode<int>* pO, vector<TreeNode*> n, vector<int> p)
-		{
-			this->strategy = s;
-			this->level = p.size();
-			this->player = p.size() % 2;
-			this->payoff = pO;
-			this->next = n;
-			this->path = p;
+			parent = -1;
+			firstChild = -1;
+			numChildren = 0;
+			level = 0;
+			player = -1;
+			payoffIndex = -1;
+			choice = -1;
+			infoSet = -1;
 		}
-		
-		TreeNode(vector<int> p)
+
+		TreeNode(int p, int l, int pl)
 		{
-			this->strategy = 0;
-			this->level = 0;
-			this->player = level % 2;
-			this->payoff = new ListNode<int>;
-			this->payoff = NULL;
-			
-			this->next = vector<TreeNode*>(1);
-			
-			// next = vector<TreeNode*>(players[player]->getNumStrategies());
-			// for (int i = 0; i < players[player]->getNumStrategies(); i++)
-				// next.at(i) = NULL;
-			
-			this->path = p;
+			parent = p;
+			firstChild = -1;
+			numChildren = 0;
+			level = l;
+			player = pl;
+			payoffIndex = -1;
+			choice = -1;
+			infoSet = -1;
 		}
-		
-		~TreeNode()
-		{ cout << "\nDeleted a node."; }
-		
-		void addNext()
-		{ next.push_back(NULL); }
-		
-		int getLevel()
-		{ return this->level; }
-		
-		TreeNode* getNext(int i)
-		{ return next.at(i); }
-		
-		vector<int> getPath()
-		{ return path; }
-		
-		int getPathVertex(int i)
-		{ return path.at(i); }
-		
-		ListNode<int>* getPayoff()
-		{ return this->payoff; }
-		
-		int getNodePlayer()
-		{ return player; }
-		
-		int getSizeNext()
-		{ return next.size(); }
-		
-		int getStrategy()
-		{ return strategy; }
-		
-		void setNext(int i, TreeNode* curNode)
-		{ next.at(i) = curNode; }
-		
-		void setNextPlayer(int i, int index)
-		{ next.at(i)->setPlayer(index); }
-		
-		void setPathVertex(int i, int num)
-		{ path.at(i) = num; }
-		
-		void setPayoff(ListNode<int>* node)
-		{ payoff = node; }
-		
-		void setPath(vector<int> p)
-		{ this->path = p; }
-		
-		void setPlayer(int num)
-		{ player = num; }
-		
-		void setStrategy(int num)
-		{ strategy = num; }
+
+		int getChoice() const		{ return choice; }
+		int getFirstChild() const	{ return firstChild; }
+		int getInfoSet() const		{ return infoSet; }
+		int getLevel() const		{ return level; }
+		int getNodePlayer() const	{ return player; }
+		int getNumChildren() const	{ return numChildren; }
+		int getParent() const		{ return parent; }
+		int getPayoffIndex() const	{ return payoffIndex; }
+		bool isLeaf() const			{ return numChildren == 0; }
+		bool isPlaceholder() const	{ return player == -1; }
+
+		void setChildren(int f, int n)	{ firstChild = f; numChildren = n; }
+		void setChoice(int s)			{ choice = s; }
+		void setInfoSet(int h)			{ infoSet = h; }
+		void setLevel(int l)			{ level = l; }
+		void setParent(int p)			{ parent = p; }
+		void setPayoffIndex(int i)		{ payoffIndex = i; }
+		void setPlayer(int num)			{ player = num; }
 };
 
-#endif
\ No newline at end of file
+#endif
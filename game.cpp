@@ -6,17 +6,18 @@ Purpose: Game theory program
 ********************************/
 #include "simGame.h"
 #include "seqGame.h"
+#include "GameDAG.h"
+#include "MCCFR.h"
 
 int main()
 {
 	int menu = -1, numPlayers = 2, oList = 1, secondColumn = 10;
 	int type = -1;
-	char impartial = '\n', load = '\n', save = '\n', startRand = '\n';
+	char impartial = '\n', load = '\n', save = '\n', startRand = '\n', exact = '\n';
 	
-	// cout << "Is the game simultaneous(1) or sequential(2)? Enter 1 or 2:  ";
-	// cin >> type;
-	// validate(type, 1, 2);
-	type = 1;
+	cout << "Is the game simultaneous(1) or sequential(2)? Enter 1 or 2:  ";
+	cin >> type;
+	validate(type, 1, 2);
 	
 	// cout << "Enter the number of players in the game.  ";
 	// cin >> numPlayers;
@@ -25,12 +26,16 @@ int main()
 	if (type == 1)
 	{
 		simGame<int>* game = new simGame<int>(numPlayers);
+		
+		// analyses of games read from files, so reading one again skips the work
+		AnalysisCache cache("analysisCache.txt");
+		cache.load();
 	
 		cout << "Load game from file? Enter y or n:  ";
 		cin >> load;
 		validateChar(load);
 		if (load == 'y')
-			game->readFromFile();
+			game->readFromFile(&cache);
 		else
 		{
 			cout << "Start with a random game? Enter y or n:  ";
@@ -122,7 +127,10 @@ int main()
 						break;
 				case 9: game->printPlayers();
 						break;
-				case 10: game->computeMixedEquilibria();
+				case 10: cout << "Use exact fractions? Enter y or n:  ";
+						cin >> exact;
+						validateChar(exact);
+						game->computeMixedEquilibria(exact == 'y' || exact == 'Y');
 						break;
 				case 11: game->reduce();
 						break;
@@ -130,7 +138,7 @@ int main()
 						break;
 				case 13: game->communication();
 						break;
-				case 14: game->readFromFile();
+				case 14: game->readFromFile(&cache);
 						break;
 				case 15: game->saveToFile();
 						break;				
@@ -160,19 +168,43 @@ int main()
 			0	1
 		*/
 		
-		vector<int> rootPath{-1};
-		vector<int> path1{-1, 0};
-		vector<int> path2{-1, 1};
-		vector<int> path3{-1, 0, 0};
-		vector<int> path4{-1, 0, 1};
+		vector<int> path1{-1, 0, 0};
+		vector<int> path2{-1, 0, 1};
+		vector<int> path3{-1, 1};
 		
-		game->insert(game->getRoot(), rootPath);
-		game->insert(game->getRoot(), path1);
-		game->insert(game->getRoot(), path2);
-		// game->insert(game->getRoot(), path3);
-		// game->insert(game->getRoot(), path4);
+		game->insert(path1, vector<int>{3, 1});
+		game->insert(path2, vector<int>{0, 0});
+		game->insert(path3, vector<int>{2, 2});
 		
 		game->display(game->getRoot(), 0);
+		game->printSubgamePerfect();
+		
+		// the same game with identical subgames stored once
+		GameDAG dag(2);
+		dag.printSubgamePerfect(dag.addTree(*game, game->getRoot()));
+		
+		// the same game in reduced normal form
+		simGame<int>* normalForm = new simGame<int>(2);
+		if (game->toNormalForm(normalForm, 1000000))
+		{
+			normalForm->printPayoffMatrix();
+			normalForm->printPureEquilibria();
+		}
+		
+		// matching pennies, where P_2 doesn't see P_1's coin
+		SeqGame* pennies = new SeqGame(2);
+		pennies->insert(vector<int>{-1, 0, 0}, vector<int>{1, -1});
+		pennies->insert(vector<int>{-1, 0, 1}, vector<int>{-1, 1});
+		pennies->insert(vector<int>{-1, 1, 0}, vector<int>{-1, 1});
+		pennies->insert(vector<int>{-1, 1, 1}, vector<int>{1, -1});
+		pennies->setInfoSet(pennies->search(vector<int>{-1, 0}), 1);
+		pennies->setInfoSet(pennies->search(vector<int>{-1, 1}), 1);
+		pennies->printSequenceFormSolution();
+		
+		// the same game by sampling
+		MCCFR cfr(pennies);
+		cfr.run(100000, 0, 10, 1);
+		cfr.printAverageStrategy();
 		
 		// game->displayPreOrder(game->getRoot());
 		
@@ -0,0 +1,160 @@
+/*************************************************
+Title: incrementalEquilibria.cpp
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: edits one payoff at a time and checks the
+		 pure equilibria setPayoff() patches in
+		 against a brute-force scan
+
+		 g++ -std=c++11 -pthread tests/incrementalEquilibria.cpp
+**************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../SimGame.h"
+using namespace std;
+
+// next profile with P_1 varying fastest; false after the last one
+bool nextProfile(vector<int> &profile, const vector<int> &numStrats)
+{
+	for (int x = 0; (unsigned)x < numStrats.size(); x++)
+	{
+		profile.at(x)++;
+		if (profile.at(x) < numStrats.at(x))
+			return true;
+		profile.at(x) = 0;
+	}
+	return false;
+}
+
+// index of profile in payoffs, P_1 fastest
+int outcome(const vector<int> &profile, const vector<int> &numStrats)
+{
+	int o = 0;
+	for (int x = numStrats.size() - 1; x >= 0; x--)
+		o = o * numStrats.at(x) + profile.at(x);
+	return o;
+}
+
+/*
+	The game's pure equilibria, sorted, read back from writePureEquilibria() in CSV:
+		record,profile,payoffs,paretoOptimal
+		pureEquilibrium,0 1,3 1,true
+*/
+vector<vector<int> > writtenEquilibria(simGame<int>* game)
+{
+	vector<vector<int> > equilibria;
+	stringstream out;
+	{
+		ResultWriter writer(out, true);
+		game->writePureEquilibria(writer);
+	}
+
+	string line;
+	while (getline(out, line))
+	{
+		if (line.compare(0, 7, "record,") == 0)
+			continue;
+		int start = line.find(',') + 1;
+		stringstream profile(line.substr(start, line.find(',', start) - start));
+		equilibria.push_back(vector<int>());
+		int s;
+		while (profile >> s)
+			equilibria.back().push_back(s);
+	}
+	sort(equilibria.begin(), equilibria.end());
+	return equilibria;
+}
+
+// profiles where nobody gains by deviating, sorted
+vector<vector<int> > bruteForceEquilibria(const vector<vector<int> > &payoffs, const vector<int> &numStrats)
+{
+	vector<vector<int> > equilibria;
+	vector<int> profile = vector<int>(numStrats.size(), 0);
+	do
+	{
+		bool isEquilibrium = true;
+		for (int x = 0; (unsigned)x < numStrats.size() && isEquilibrium; x++)
+		{
+			vector<int> deviation = profile;
+			for (int s = 0; s < numStrats.at(x); s++)
+			{
+				deviation.at(x) = s;
+				if (payoffs.at(outcome(deviation, numStrats)).at(x) > payoffs.at(outcome(profile, numStrats)).at(x))
+					isEquilibrium = false;
+			}
+		}
+		if (isEquilibrium)
+			equilibria.push_back(profile);
+	} while (nextProfile(profile, numStrats));
+
+	sort(equilibria.begin(), equilibria.end());
+	return equilibria;
+}
+
+/*
+	Games with 2 to 6 players and 2 to 4 strategies each. After building one, it's
+	edited one payoff at a time. Most edits come right after the equilibria were
+	computed, so setPayoff() patches them in place, and the rest pile up first.
+	Payoffs from 0 to 4 make ties, so edits often add and remove equilibria.
+*/
+int main()
+{
+	const int numGames = 200;
+	const int numEdits = 100;
+	int numFailures = 0, numChecks = 0;
+
+	srand(30);
+	for (int g = 0; g < numGames; g++)
+	{
+		int numPlayers = 2 + g % 5;
+		vector<int> numStrats = vector<int>(numPlayers);
+		int numOutcomes = 1;
+		for (int x = 0; x < numPlayers; x++)
+		{
+			numStrats.at(x) = 2 + rand() % (numPlayers > 4 ? 2 : 3);
+			numOutcomes *= numStrats.at(x);
+		}
+
+		simGame<int>* game = new simGame<int>(numPlayers);
+		game->setAllNumStrats(numStrats);
+		vector<vector<int> > payoffs = vector<vector<int> >(numOutcomes, vector<int>(numPlayers));
+		vector<int> profile = vector<int>(numPlayers, 0);
+		do
+		{
+			for (int x = 0; x < numPlayers; x++)
+			{
+				payoffs.at(outcome(profile, numStrats)).at(x) = rand() % 5;
+				game->setPayoff(profile, x, payoffs.at(outcome(profile, numStrats)).at(x));
+			}
+		} while (nextProfile(profile, numStrats));
+
+		for (int e = 0; e < numEdits; e++)
+		{
+			if (rand() % 4 != 0)
+				writtenEquilibria(game); // brings the best responses and equilibria up to date
+
+			int x = rand() % numPlayers;
+			for (int y = 0; y < numPlayers; y++)
+				profile.at(y) = rand() % numStrats.at(y);
+			payoffs.at(outcome(profile, numStrats)).at(x) = rand() % 5;
+			game->setPayoff(profile, x, payoffs.at(outcome(profile, numStrats)).at(x));
+
+			vector<vector<int> > equilibria = writtenEquilibria(game);
+			numChecks++;
+			if (equilibria != bruteForceEquilibria(payoffs, numStrats))
+			{
+				cout << "game " << g << ", edit " << e << ": " << equilibria.size() << " equilibria, "
+					<< bruteForceEquilibria(payoffs, numStrats).size() << " by brute force\n";
+				numFailures++;
+			}
+		}
+	}
+
+	cout << numChecks << " edits, " << numFailures << " wrong\n";
+	return numFailures == 0 ? 0 : 1;
+}
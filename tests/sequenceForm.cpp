@@ -0,0 +1,208 @@
+/*************************************************
+Title: sequenceForm.cpp
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: solves random zero-sum games of imperfect
+		 information through the sequence form and
+		 checks them against their normal form
+
+		 g++ -std=c++11 -pthread tests/sequenceForm.cpp
+**************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "../SeqGame.h"
+using namespace std;
+
+/*
+	Puts every decision node in an information set. A node's player remembers their own
+	information sets and actions on the way down, which gives perfect recall, but only
+	sees each of the other player's actions mod numSignals, so numSignals = 1 hides
+	them completely.
+*/
+void labelInformationSets(SeqGame &game, int numSignals)
+{
+	map<string, int> labels;
+	for (int n = 0; n < game.getNumNodes(); n++)
+	{
+		if (game.getNode(n).isLeaf())
+			continue;
+
+		int x = game.getNode(n).getNodePlayer();
+		string history = to_string(game.getNode(n).getLevel());
+		for (int m = n; game.getNode(m).getParent() != -1; m = game.getNode(m).getParent())
+		{
+			int parent = game.getNode(m).getParent();
+			if (game.getNode(parent).getNodePlayer() == x)
+				history += " " + to_string(game.getInfoSet(parent)) + ":" + to_string(game.getStrategy(m));
+			else
+				history += " o" + to_string(game.getStrategy(m) % numSignals);
+		}
+		if (labels.count(history) == 0)
+		{
+			int label = labels.size();
+			labels[history] = label;
+		}
+		game.setInfoSet(n, labels[history]);
+	}
+}
+
+/*
+	P_1's payoff when P_x follows plan and the other player best responds. The value of
+	one of their sequences is what the leaves right after it pay plus the best action's
+	value at each information set it leads to. Those information sets come later in the
+	numbering, so going backwards finishes every sequence before it's used.
+*/
+double bestResponseValue(const SequenceForm &form, int x, const vector<double> &plan)
+{
+	int y = 1 - x;
+	vector<double> values = vector<double>(form.numSequences.at(y), 0);
+	for (int l = 0; (unsigned)l < form.leafSequences.size(); l++)
+		values.at(form.leafSequences.at(l).at(y)) += plan.at(form.leafSequences.at(l).at(x)) * form.leafPayoffs.at(l).at(0);
+
+	for (int h = form.firstSequence.at(y).size() - 1; h >= 0; h--)
+	{
+		int first = form.firstSequence.at(y).at(h);
+		double best = values.at(first);
+		for (int a = 1; a < form.numActions.at(y).at(h); a++)
+		{
+			if (y == 1)
+				best = min(best, values.at(first + a)); // P_2 holds P_1 down
+			else
+				best = max(best, values.at(first + a));
+		}
+		values.at(form.parentSequence.at(y).at(h)) += best;
+	}
+	return values.at(0);
+}
+
+// number of P_x's pure strategies, capped at cap + 1
+long long numPureStrategies(const SequenceForm &form, int x, long long cap)
+{
+	long long count = 1;
+	for (int h = 0; (unsigned)h < form.numActions.at(x).size() && count <= cap; h++)
+		count *= form.numActions.at(x).at(h);
+	return min(count, cap + 1);
+}
+
+// realization plans of all of P_x's pure strategies (one action at each information set)
+vector<vector<double> > purePlans(const SequenceForm &form, int x)
+{
+	int numSets = form.firstSequence.at(x).size();
+	vector<vector<int> > strategies = vector<vector<int> >(1);
+	for (int h = 0; h < numSets; h++)
+	{
+		vector<vector<int> > next;
+		for (int s = 0; (unsigned)s < strategies.size(); s++)
+			for (int a = 0; a < form.numActions.at(x).at(h); a++)
+			{
+				next.push_back(strategies.at(s));
+				next.back().push_back(a);
+			}
+		strategies.swap(next);
+	}
+
+	// information sets come after the ones containing their parent sequences
+	vector<vector<double> > plans;
+	for (int s = 0; (unsigned)s < strategies.size(); s++)
+	{
+		vector<double> plan = vector<double>(form.numSequences.at(x), 0);
+		plan.at(0) = 1;
+		for (int h = 0; h < numSets; h++)
+			plan.at(form.firstSequence.at(x).at(h) + strategies.at(s).at(h)) = plan.at(form.parentSequence.at(x).at(h));
+		plans.push_back(plan);
+	}
+	return plans;
+}
+
+// P_1's expected payoff when the players follow these realization plans
+double expectedPayoff(const SequenceForm &form, const vector<double> &plan1, const vector<double> &plan2)
+{
+	double payoff = 0;
+	for (int l = 0; (unsigned)l < form.leafSequences.size(); l++)
+		payoff += plan1.at(form.leafSequences.at(l).at(0)) * plan2.at(form.leafSequences.at(l).at(1)) * form.leafPayoffs.at(l).at(0);
+	return payoff;
+}
+
+/*
+	Each player's plan has to guarantee the sequence-form value against a best
+	response. Trees go up to 6 levels deep, which makes LPs with a few hundred heavily
+	degenerate rows. Where the normal form, with one action at each information set
+	per pure strategy, is small enough, its value has to match too. Small games are
+	also solved with Rationals, which can't be thrown off by degenerate pivots.
+*/
+int main()
+{
+	const int numGames = 300;
+	const long long maxProfiles = 20000;
+	int numFailures = 0, numChecked = 0;
+
+	srand(36);
+	for (int g = 0; g < numGames; g++)
+	{
+		SeqGame game(2);
+		game.randTree(1 + rand() % 6, 2 + rand() % 2);
+		for (int n = 0; n < game.getNumNodes(); n++)
+		{
+			if (game.getNode(n).isLeaf())
+				game.setPayoffs(n, vector<int>{rand() % 7 - 3, 0}); // small range, so ties and degenerate LPs are common
+		}
+		labelInformationSets(game, 1 + rand() % 3);
+
+		SequenceForm form;
+		vector<vector<double> > plans;
+		double value;
+		if (!game.computeSequenceForm(form) || !game.computeSequenceFormSolution(plans, value, 1e-9))
+		{
+			cout << "game " << g << ": the sequence form failed\n";
+			numFailures++;
+			continue;
+		}
+
+		numChecked++;
+		double guarantee1 = bestResponseValue(form, 0, plans.at(0));
+		double guarantee2 = bestResponseValue(form, 1, plans.at(1));
+		if (guarantee1 < value - 1e-6 || guarantee2 > value + 1e-6)
+		{
+			cout << "game " << g << ": the plans guarantee " << guarantee1 << " and " << guarantee2 << ", not v = " << value << endl;
+			numFailures++;
+			continue;
+		}
+
+		if (numPureStrategies(form, 0, maxProfiles) * numPureStrategies(form, 1, maxProfiles) > maxProfiles)
+			continue;
+		vector<vector<double> > pure1 = purePlans(form, 0), pure2 = purePlans(form, 1);
+
+		vector<vector<double> > A = vector<vector<double> >(pure1.size(), vector<double>(pure2.size()));
+		for (int i = 0; (unsigned)i < pure1.size(); i++)
+			for (int j = 0; (unsigned)j < pure2.size(); j++)
+				A.at(i).at(j) = expectedPayoff(form, pure1.at(i), pure2.at(j));
+
+		vector<double> rowStrategy, colStrategy;
+		double normalValue;
+		if (!solveMatrixGame(A, rowStrategy, colStrategy, normalValue, 1e-9) || fabs(normalValue - value) > 1e-6)
+		{
+			cout << "game " << g << ": v = " << value << " from the sequence form, " << normalValue << " from the normal form\n";
+			numFailures++;
+			continue;
+		}
+
+		if (form.numSequences.at(0) + form.numSequences.at(1) < 30)
+		{
+			vector<vector<Rational> > exactPlans;
+			Rational exactValue;
+			if (!game.computeSequenceFormSolution(exactPlans, exactValue, Rational(0)) || fabs(exactValue.toDouble() - value) > 1e-6)
+			{
+				cout << "game " << g << ": v = " << value << " with doubles, " << exactValue << " exactly\n";
+				numFailures++;
+			}
+		}
+	}
+
+	cout << numChecked << " games checked, " << numFailures << " wrong\n";
+	return numFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+/*************************************************
+Title: subgamePerfectParallel.cpp
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: checks that parallel backward induction
+		 gives the same values and choices as the
+		 sequential sweep
+
+		 g++ -std=c++11 -pthread tests/subgamePerfectParallel.cpp
+**************************************************/
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../SeqGame.h"
+using namespace std;
+
+// values and choices at every node, with numThreads threads; 0 means the sequential sweep
+void solve(SeqGame &game, int numThreads, int cutoff, vector<vector<int> > &values, vector<int> &choices)
+{
+	if (numThreads == 0)
+		game.computeSubgamePerfect();
+	else
+		game.computeSubgamePerfectParallel(numThreads, cutoff);
+
+	values.clear();
+	choices.clear();
+	for (int n = 0; n < game.getNumNodes(); n++)
+	{
+		values.push_back(game.getValues(n));
+		choices.push_back(game.getChoice(n));
+	}
+}
+
+// compares every thread count and cutoff with the sequential sweep; returns the number of mismatches
+int compareSolvers(SeqGame &game, const char* name)
+{
+	const int threadCounts[] = {1, 2, 4, 8};
+	const int cutoffs[] = {1, 3, 64, 1000000};
+	vector<vector<int> > values, parallelValues;
+	vector<int> choices, parallelChoices;
+	int numFailures = 0;
+
+	solve(game, 0, 0, values, choices);
+	for (int t = 0; t < 4; t++)
+		for (int c = 0; c < 4; c++)
+		{
+			solve(game, threadCounts[t], cutoffs[c], parallelValues, parallelChoices);
+			if (parallelValues != values || parallelChoices != choices)
+			{
+				cout << name << ": " << threadCounts[t] << " threads with cutoff " << cutoffs[c] << " differ\n";
+				numFailures++;
+			}
+		}
+	return numFailures;
+}
+
+/*
+	Random trees with 2 to 4 players: complete ones from randTree(), whose payoffs
+	from 0 to 99 give plenty of ties, and ragged ones with placeholders from insert().
+	Then a centipede game, a spine 20000 levels deep, where every node's subtree
+	is large and only one branch is worth splitting off.
+*/
+int main()
+{
+	const int numGames = 200;
+	const int depth = 20000;
+	int numFailures = 0;
+
+	srand(33);
+	for (int g = 0; g < numGames; g++)
+	{
+		SeqGame game(2 + g % 3);
+		if (g % 2 == 0)
+			game.randTree(1 + rand() % 8, 2 + rand() % 2);
+		else
+		{
+			int numLeaves = 1 + rand() % 60;
+			for (int l = 0; l < numLeaves; l++)
+			{
+				vector<int> path{-1};
+				int length = 1 + rand() % 6;
+				for (int lev = 0; lev < length; lev++)
+					path.push_back(rand() % 3);
+				if (game.search(path) != -1)
+					continue;
+
+				vector<int> payoffs;
+				for (int x = 0; x < game.getNumPlayers(); x++)
+					payoffs.push_back(rand() % 5);
+				game.insert(path, payoffs);
+			}
+		}
+		numFailures += compareSolvers(game, ("game " + to_string(g)).c_str());
+	}
+
+	// at level l the mover can take the pot, l + 2 for them and l for the other player
+	SeqGame centipede(2);
+	vector<int> path{-1};
+	for (int l = 0; l < depth; l++)
+	{
+		vector<int> take = path;
+		take.push_back(0);
+		centipede.insert(take, l % 2 == 0 ? vector<int>{l + 2, l} : vector<int>{l, l + 2});
+		path.push_back(1);
+	}
+	centipede.insert(path, vector<int>{depth + 1, depth + 1});
+	numFailures += compareSolvers(centipede, "centipede");
+
+	centipede.computeSubgamePerfectParallel(4, 64);
+	if (centipede.getValues(0) != vector<int>{2, 0})
+	{
+		cout << "centipede: P_1 should take the pot at the root\n";
+		numFailures++;
+	}
+
+	cout << numGames + 1 << " games, " << numFailures << " mismatches\n";
+	return numFailures == 0 ? 0 : 1;
+}
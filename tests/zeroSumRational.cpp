@@ -0,0 +1,89 @@
+/*************************************************
+Title: zeroSumRational.cpp
+Author: Andrew Lounsbury
+Date: 10/19/2026
+Purpose: solves random zero-sum games with doubles
+		 and with exact fractions and checks that
+		 they agree
+		 
+		 g++ -std=c++11 tests/zeroSumRational.cpp
+**************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "../LinearProgram.h"
+using namespace std;
+
+/*
+	A Rational solution has to be an exact equilibrium: the row strategy guarantees at
+	least v against every column and the column strategy holds every row to at most v.
+	It also has to match the double solution. Simplex tableaus of 8 x 8 games have
+	numerators and denominators past 2^63, so this fails if Rational ever wraps around.
+*/
+int main()
+{
+	const int numGames = 200;
+	int numFailures = 0;
+	
+	srand(26);
+	for (int g = 0; g < numGames; g++)
+	{
+		int rows = 6 + rand() % 3, cols = 6 + rand() % 3;
+		vector<vector<double> > A = vector<vector<double> >(rows, vector<double>(cols));
+		vector<vector<Rational> > exactA = vector<vector<Rational> >(rows, vector<Rational>(cols));
+		for (int i = 0; i < rows; i++)
+			for (int j = 0; j < cols; j++)
+			{
+				int payoff = rand() % 201 - 100;
+				A.at(i).at(j) = payoff;
+				exactA.at(i).at(j) = Rational(payoff);
+			}
+		
+		vector<double> rowStrategy, colStrategy;
+		double value;
+		if (!solveMatrixGame(A, rowStrategy, colStrategy, value, 1e-9))
+		{
+			cout << "game " << g << ": the double LP failed\n";
+			numFailures++;
+			continue;
+		}
+		
+		vector<Rational> exactRow, exactCol;
+		Rational exactValue;
+		if (!solveMatrixGame(exactA, exactRow, exactCol, exactValue, Rational(0)))
+		{
+			cout << "game " << g << ": the exact LP failed\n";
+			numFailures++;
+			continue;
+		}
+		
+		bool isEquilibrium = true;
+		for (int j = 0; j < cols; j++)
+		{
+			Rational payoff = Rational(0);
+			for (int i = 0; i < rows; i++)
+				payoff += exactRow.at(i) * exactA.at(i).at(j);
+			if (payoff < exactValue)
+				isEquilibrium = false;
+		}
+		for (int i = 0; i < rows; i++)
+		{
+			Rational payoff = Rational(0);
+			for (int j = 0; j < cols; j++)
+				payoff += exactCol.at(j) * exactA.at(i).at(j);
+			if (payoff > exactValue)
+				isEquilibrium = false;
+		}
+		
+		if (!isEquilibrium || fabs(exactValue.toDouble() - value) > 1e-6)
+		{
+			cout << "game " << g << ": v = " << value << " with doubles, " << exactValue << " exactly\n";
+			numFailures++;
+		}
+	}
+	
+	cout << numGames << " games, " << numFailures << " wrong\n";
+	return numFailures == 0 ? 0 : 1;
+}